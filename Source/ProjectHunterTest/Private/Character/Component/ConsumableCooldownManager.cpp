@@ -0,0 +1,195 @@
+// Character/Component/ConsumableCooldownManager.cpp
+
+#include "Character/Component/ConsumableCooldownManager.h"
+#include "Item/ItemInstance.h"
+#include "Engine/DataTable.h"
+#include "GameFramework/GameStateBase.h"
+#include "Net/UnrealNetwork.h"
+#include "Engine/World.h"
+
+UConsumableCooldownManager::UConsumableCooldownManager()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	SetIsReplicatedByDefault(true);
+}
+
+void UConsumableCooldownManager::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME_CONDITION(UConsumableCooldownManager, ActiveCooldowns, COND_OwnerOnly);
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// ITEM API
+// ═══════════════════════════════════════════════════════════════════════
+
+FName UConsumableCooldownManager::GetCooldownKey(const UItemInstance* Item)
+{
+	if (!Item)
+	{
+		return NAME_None;
+	}
+
+	if (const FItemBase* Base = Item->GetBaseData())
+	{
+		if (!Base->ConsumableData.CooldownGroup.IsNone())
+		{
+			return Base->ConsumableData.CooldownGroup;
+		}
+	}
+
+	// Row names are only unique within a table - qualify them so same-named rows
+	// in different base tables do not share a cooldown
+	if (const UDataTable* Table = Item->BaseItemHandle.DataTable)
+	{
+		return FName(*FString::Printf(TEXT("%s.%s"), *Table->GetName(), *Item->BaseItemHandle.RowName.ToString()));
+	}
+
+	return Item->BaseItemHandle.RowName;
+}
+
+void UConsumableCooldownManager::StartItemCooldown(const UItemInstance* Item)
+{
+	const FItemBase* Base = Item ? Item->GetBaseData() : nullptr;
+	if (!Base || Base->ConsumableData.Cooldown <= 0.0f)
+	{
+		return;
+	}
+
+	StartCooldown(GetCooldownKey(Item), Base->ConsumableData.Cooldown);
+}
+
+bool UConsumableCooldownManager::IsItemOnCooldown(const UItemInstance* Item) const
+{
+	return IsOnCooldown(GetCooldownKey(Item));
+}
+
+float UConsumableCooldownManager::GetItemCooldownProgress(const UItemInstance* Item) const
+{
+	return GetCooldownProgress(GetCooldownKey(Item));
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// KEY API
+// ═══════════════════════════════════════════════════════════════════════
+
+void UConsumableCooldownManager::StartCooldown(FName CooldownKey, float Duration)
+{
+	if (CooldownKey.IsNone() || Duration <= 0.0f)
+	{
+		return;
+	}
+
+	const double Now = GetServerTime();
+	PruneExpired(Now);
+
+	// Clients write too (prediction) - replication overwrites with server truth
+	FConsumableCooldownEntry* Existing = ActiveCooldowns.FindByPredicate([CooldownKey](const FConsumableCooldownEntry& Entry)
+	{
+		return Entry.CooldownKey == CooldownKey;
+	});
+
+	if (Existing)
+	{
+		Existing->StartTime = Now;
+		Existing->EndTime = Now + Duration;
+	}
+	else
+	{
+		ActiveCooldowns.Emplace(CooldownKey, Now, Now + Duration);
+	}
+
+	OnCooldownStarted.Broadcast(CooldownKey, Duration);
+}
+
+bool UConsumableCooldownManager::IsOnCooldown(FName CooldownKey) const
+{
+	return GetRemainingTime(CooldownKey) > 0.0f;
+}
+
+float UConsumableCooldownManager::GetRemainingTime(FName CooldownKey) const
+{
+	const FConsumableCooldownEntry* Entry = FindEntry(CooldownKey);
+	if (!Entry)
+	{
+		return 0.0f;
+	}
+
+	return static_cast<float>(FMath::Max(0.0, Entry->EndTime - GetServerTime()));
+}
+
+float UConsumableCooldownManager::GetCooldownProgress(FName CooldownKey) const
+{
+	const FConsumableCooldownEntry* Entry = FindEntry(CooldownKey);
+	if (!Entry || Entry->GetDuration() <= 0.0)
+	{
+		return 1.0f;
+	}
+
+	return FMath::Clamp(static_cast<float>((GetServerTime() - Entry->StartTime) / Entry->GetDuration()), 0.0f, 1.0f);
+}
+
+void UConsumableCooldownManager::ClearAllCooldowns()
+{
+	ActiveCooldowns.Empty();
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// REPLICATION
+// ═══════════════════════════════════════════════════════════════════════
+
+void UConsumableCooldownManager::OnRep_ActiveCooldowns()
+{
+	// Only broadcast entries that are still running (late joiners / reconnects)
+	const double Now = GetServerTime();
+	for (const FConsumableCooldownEntry& Entry : ActiveCooldowns)
+	{
+		if (Entry.EndTime > Now)
+		{
+			OnCooldownStarted.Broadcast(Entry.CooldownKey, static_cast<float>(Entry.EndTime - Now));
+		}
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// INTERNAL
+// ═══════════════════════════════════════════════════════════════════════
+
+double UConsumableCooldownManager::GetServerTime() const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return 0.0;
+	}
+
+	// Timestamps are written by the server - clients must read the synced server clock
+	if (const AGameStateBase* GameState = World->GetGameState())
+	{
+		return GameState->GetServerWorldTimeSeconds();
+	}
+
+	return World->GetTimeSeconds();
+}
+
+const FConsumableCooldownEntry* UConsumableCooldownManager::FindEntry(FName CooldownKey) const
+{
+	if (CooldownKey.IsNone())
+	{
+		return nullptr;
+	}
+
+	return ActiveCooldowns.FindByPredicate([CooldownKey](const FConsumableCooldownEntry& Entry)
+	{
+		return Entry.CooldownKey == CooldownKey;
+	});
+}
+
+void UConsumableCooldownManager::PruneExpired(double Now)
+{
+	ActiveCooldowns.RemoveAllSwap([Now](const FConsumableCooldownEntry& Entry)
+	{
+		return Entry.EndTime <= Now;
+	});
+}
@@ -10,10 +10,13 @@
 
 DEFINE_LOG_CATEGORY(LogGroundItemPickupManager);
 
+int32 FGroundItemPickupManager::NextPickupRequestID = 0;
+
 FGroundItemPickupManager::FGroundItemPickupManager()
 	: PickupRadius(500.0f)
 	, HoldToEquipDuration(0.5f)
 	, bShowEquipHint(true)
+	, MaxBatchPickup(64)
 	, OwnerActor(nullptr)
 	, WorldContext(nullptr)
 	, CachedInventoryManager(nullptr)
@@ -21,8 +24,7 @@ FGroundItemPickupManager::FGroundItemPickupManager()
 	, CachedGroundItemSubsystem(nullptr)
 	, bIsHoldingForGroundItem(false)
 	, CurrentHoldItemID(-1)
-	, HoldElapsedTime(0.0f)
-	, HoldProgress(0.0f)
+	, HoldStartTime(0.0)
 {
 }
 
@@ -59,17 +61,14 @@ bool FGroundItemPickupManager::PickupToInventory(int32 ItemID)
 		return false;
 	}
 
-	// Get client location for validation
-	FVector ClientLocation = OwnerActor->GetActorLocation();
-
-	// If on server, execute directly
-	if (OwnerActor->HasAuthority())
+	// Clients only see replicated items - they pick up through the server RPCs on UInteractionManager
+	if (!OwnerActor->HasAuthority())
 	{
-		return PickupToInventoryInternal(ItemID, ClientLocation);
+		UE_LOG(LogGroundItemPickupManager, Warning, TEXT("GroundItemPickupManager: PickupToInventory(%d) needs authority"), ItemID);
+		return false;
 	}
 
-	// TODO: Add RPC call here for networked games
-	return PickupToInventoryInternal(ItemID, ClientLocation);
+	return PickupToInventoryInternal(ItemID, OwnerActor->GetActorLocation());
 }
 
 bool FGroundItemPickupManager::PickupAndEquip(int32 ItemID)
@@ -85,17 +84,14 @@ bool FGroundItemPickupManager::PickupAndEquip(int32 ItemID)
 		return false;
 	}
 
-	// Get client location for validation
-	FVector ClientLocation = OwnerActor->GetActorLocation();
-
-	// If on server, execute directly
-	if (OwnerActor->HasAuthority())
+	// Clients only see replicated items - they pick up through the server RPCs on UInteractionManager
+	if (!OwnerActor->HasAuthority())
 	{
-		return PickupAndEquipInternal(ItemID, ClientLocation);
+		UE_LOG(LogGroundItemPickupManager, Warning, TEXT("GroundItemPickupManager: PickupAndEquip(%d) needs authority"), ItemID);
+		return false;
 	}
 
-	// TODO: Add RPC call here for networked games
-	return PickupAndEquipInternal(ItemID, ClientLocation);
+	return PickupAndEquipInternal(ItemID, OwnerActor->GetActorLocation());
 }
 
 int32 FGroundItemPickupManager::PickupAllNearby(FVector Location)
@@ -105,40 +101,212 @@ int32 FGroundItemPickupManager::PickupAllNearby(FVector Location)
 		return 0;
 	}
 
-	// Get all items in radius
-	
-	TArray<UItemInstance*> NearbyItems = CachedGroundItemSubsystem->GetItemInstancesInRadius(Location, PickupRadius);
+	TArray<int32> ItemIDs;
+	GatherNearbyItemIDs(Location, ItemIDs);
 
-	int32 PickedUpCount = 0;
-	
-	for (UItemInstance* Item : NearbyItems)
+	FGroundItemPickupResult Result;
+	Result.NumRequested = ItemIDs.Num();
+	PickupItemsToInventory(ItemIDs, Result);
+
+	return Result.PickedUpItemIDs.Num();
+}
+
+int32 FGroundItemPickupManager::GatherNearbyItemIDs(FVector Location, TArray<int32>& OutItemIDs) const
+{
+	OutItemIDs.Reset();
+
+	if (!CachedGroundItemSubsystem)
 	{
-		if (!Item)
+		return 0;
+	}
+
+	CachedGroundItemSubsystem->GetItemsInRadius(Location, PickupRadius, OutItemIDs);
+
+	if (OutItemIDs.Num() > MaxBatchPickup)
+	{
+		// Nearest first so the cap drops the far ones
+		UGroundItemSubsystem* Subsystem = CachedGroundItemSubsystem;
+		OutItemIDs.Sort([Subsystem, &Location](int32 A, int32 B)
 		{
-			continue;
+			return FVector::DistSquared(*Subsystem->GetItemLocation(A), Location) < FVector::DistSquared(*Subsystem->GetItemLocation(B), Location);
+		});
+		OutItemIDs.SetNum(MaxBatchPickup, EAllowShrinking::No);
+	}
+
+	return OutItemIDs.Num();
+}
+
+void FGroundItemPickupManager::PickupItemsToInventory(const TArray<int32>& ItemIDs, FGroundItemPickupResult& OutResult)
+{
+	if (!CachedGroundItemSubsystem || !CachedInventoryManager || ItemIDs.Num() == 0)
+	{
+		return;
+	}
+
+	// Items go into the inventory while still on the ground, so whatever doesn't fit never leaves it
+	TArray<UItemInstance*> Items;
+	TArray<int32> FoundIDs;
+	TArray<int32> QuantitiesBefore;
+	Items.Reserve(ItemIDs.Num());
+	FoundIDs.Reserve(ItemIDs.Num());
+	QuantitiesBefore.Reserve(ItemIDs.Num());
+
+	for (int32 ItemID : ItemIDs)
+	{
+		UItemInstance* Item = CachedGroundItemSubsystem->GetItemByID(ItemID);
+		if (Item && !Items.Contains(Item))
+		{
+			Items.Add(Item);
+			FoundIDs.Add(ItemID);
+			QuantitiesBefore.Add(Item->Quantity);
 		}
+	}
 
-		// NOTE: You may need to add GetInstanceID() to your GroundItemSubsystem
-		// It should return the int32 ID for a given UItemInstance*
-		int32 ItemID = CachedGroundItemSubsystem->GetInstanceID(Item);
-		
-		if (ItemID == -1)
+	// OPTIMIZATION: One inventory insert + one ground removal for the whole batch
+	TArray<UItemInstance*> Rejected;
+	CachedInventoryManager->AddItems(Items, Rejected);
+
+	const TSet<UItemInstance*> RejectedSet(Rejected);
+	OutResult.PickedUpItemIDs.Reserve(Items.Num());
+	for (int32 Index = 0; Index < Items.Num(); ++Index)
+	{
+		if (!RejectedSet.Contains(Items[Index]))
 		{
-			UE_LOG(LogGroundItemPickupManager, Warning, TEXT("GroundItemPickupManager: Could not get ID for item %s"), 
-				*Item->GetDisplayName().ToString());
-			continue;
+			OutResult.PickedUpItemIDs.Add(FoundIDs[Index]);
+		}
+		else if (Items[Index]->Quantity != QuantitiesBefore[Index])
+		{
+			// Part of the stack merged before the inventory filled - keep the ID, publish the new count
+			CachedGroundItemSubsystem->NotifyItemChanged(FoundIDs[Index]);
 		}
+	}
+
+	CachedGroundItemSubsystem->RemoveMultipleItemsFromGround(OutResult.PickedUpItemIDs);
+	OutResult.NumReturned += Rejected.Num();
+
+	UE_LOG(LogGroundItemPickupManager, Log, TEXT("GroundItemPickupManager: Picked up %d/%d items (left %d on the ground)"),
+		OutResult.PickedUpItemIDs.Num(), ItemIDs.Num(), Rejected.Num());
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// PREDICTION (CLIENT)
+// ═══════════════════════════════════════════════════════════════════════
+
+int32 FGroundItemPickupManager::BeginPredictedPickup(const TArray<int32>& ItemIDs, TArray<int32>& OutPredictedIDs)
+{
+	OutPredictedIDs.Reset();
+
+	if (!CachedGroundItemSubsystem || ItemIDs.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	// Hidden items leave every ground query, so in-flight IDs are filtered here and can't be refocused
+	OutPredictedIDs = CachedGroundItemSubsystem->HidePredictedItems(ItemIDs);
+	if (OutPredictedIDs.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	// Skip INDEX_NONE on wrap - it means "server-local" in FGroundItemPickupResult
+	NextPickupRequestID = NextPickupRequestID == MAX_int32 ? 0 : NextPickupRequestID + 1;
+
+	FPredictedPickup& Pickup = PredictedPickups.AddDefaulted_GetRef();
+	Pickup.RequestID = NextPickupRequestID;
+	Pickup.ItemIDs = OutPredictedIDs;
+	Pickup.StartTime = WorldContext ? WorldContext->GetTimeSeconds() : 0.0;
+
+	UE_LOG(LogGroundItemPickupManager, Verbose, TEXT("GroundItemPickupManager: Predicted pickup %d (%d/%d items)"),
+		Pickup.RequestID, OutPredictedIDs.Num(), ItemIDs.Num());
+
+	return Pickup.RequestID;
+}
 
-		// Reuse existing pickup logic (handles validation, removal, etc.)
-		if (PickupToInventory(ItemID))
+void FGroundItemPickupManager::ResolvePredictedPickup(int32 RequestID, const TArray<int32>& PickedUpItemIDs, TArray<int32>& OutRolledBackIDs)
+{
+	OutRolledBackIDs.Reset();
+
+	const int32 PickupIndex = PredictedPickups.IndexOfByPredicate([RequestID](const FPredictedPickup& Pickup)
+	{
+		return Pickup.RequestID == RequestID;
+	});
+
+	if (PickupIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	FPredictedPickup Pickup = MoveTemp(PredictedPickups[PickupIndex]);
+	PredictedPickups.RemoveAt(PickupIndex, 1, EAllowShrinking::No);
+
+	if (!CachedGroundItemSubsystem)
+	{
+		return;
+	}
+
+	const TSet<int32> Confirmed(PickedUpItemIDs);
+	for (int32 ItemID : Pickup.ItemIDs)
+	{
+		if (!Confirmed.Contains(ItemID))
+		{
+			OutRolledBackIDs.Add(ItemID);
+		}
+	}
+
+	CachedGroundItemSubsystem->ConfirmPredictedItems(PickedUpItemIDs);
+	CachedGroundItemSubsystem->RestorePredictedItems(OutRolledBackIDs);
+
+	if (OutRolledBackIDs.Num() > 0)
+	{
+		UE_LOG(LogGroundItemPickupManager, Log, TEXT("GroundItemPickupManager: Pickup %d rolled back %d/%d items"),
+			RequestID, OutRolledBackIDs.Num(), Pickup.ItemIDs.Num());
+	}
+}
+
+float FGroundItemPickupManager::ExpirePredictedPickups(TArray<int32>& OutRolledBackIDs)
+{
+	OutRolledBackIDs.Reset();
+
+	if (!CachedGroundItemSubsystem || !WorldContext || PredictedPickups.Num() == 0)
+	{
+		return 0.0f;
+	}
+
+	const double Now = WorldContext->GetTimeSeconds();
+	const float Timeout = CachedGroundItemSubsystem->PredictedRemovalTimeout;
+	float NextExpiry = 0.0f;
+
+	for (int32 Index = PredictedPickups.Num() - 1; Index >= 0; --Index)
+	{
+		const FPredictedPickup& Pickup = PredictedPickups[Index];
+		const float Remaining = Timeout - static_cast<float>(Now - Pickup.StartTime);
+		if (Remaining > 0.0f)
 		{
-			PickedUpCount++;
+			NextExpiry = NextExpiry > 0.0f ? FMath::Min(NextExpiry, Remaining) : Remaining;
+			continue;
 		}
+
+		UE_LOG(LogGroundItemPickupManager, Log, TEXT("GroundItemPickupManager: Pickup %d unanswered after %.1fs, rolling back %d items"),
+			Pickup.RequestID, Timeout, Pickup.ItemIDs.Num());
+
+		OutRolledBackIDs.Append(Pickup.ItemIDs);
+		PredictedPickups.RemoveAt(Index, 1, EAllowShrinking::No);
 	}
 
-	UE_LOG(LogGroundItemPickupManager, Log, TEXT("GroundItemPickupManager: Picked up %d/%d items from area"), 
-		PickedUpCount, NearbyItems.Num());
-	return PickedUpCount;
+	// Items the subsystem already timed out itself are skipped there
+	CachedGroundItemSubsystem->RestorePredictedItems(OutRolledBackIDs);
+
+	return NextExpiry;
+}
+
+int32 FGroundItemPickupManager::GetNumPredictedItems() const
+{
+	int32 Count = 0;
+	for (const FPredictedPickup& Pickup : PredictedPickups)
+	{
+		Count += Pickup.ItemIDs.Num();
+	}
+	return Count;
 }
 
 void FGroundItemPickupManager::StartHoldInteraction(int32 ItemID)
@@ -150,42 +318,36 @@ void FGroundItemPickupManager::StartHoldInteraction(int32 ItemID)
 
 	bIsHoldingForGroundItem = true;
 	CurrentHoldItemID = ItemID;
-	HoldElapsedTime = 0.0f;
-	HoldProgress = 0.0f;
+	HoldStartTime = WorldContext ? WorldContext->GetTimeSeconds() : 0.0;
 
 	UE_LOG(LogTemp, Log, TEXT("GroundItemPickupManager: Hold interaction started for item %d"), ItemID);
 }
 
-bool FGroundItemPickupManager::UpdateHoldProgress(float DeltaTime)
+int32 FGroundItemPickupManager::CompleteHoldInteraction()
 {
 	if (!bIsHoldingForGroundItem)
 	{
-		return false;
+		return -1;
 	}
 
-	// Update elapsed time
-	HoldElapsedTime += DeltaTime;
-
-	// Calculate progress
-	HoldProgress = FMath::Clamp(HoldElapsedTime / HoldToEquipDuration, 0.0f, 1.0f);
+	const int32 CompletedItemID = CurrentHoldItemID;
 
-	// Check if completed
-	if (HoldProgress >= 1.0f)
-	{
-		// Execute pickup and equip
-		PickupAndEquip(CurrentHoldItemID);
+	bIsHoldingForGroundItem = false;
+	CurrentHoldItemID = -1;
 
-		// Reset state
-		bIsHoldingForGroundItem = false;
-		CurrentHoldItemID = -1;
-		HoldElapsedTime = 0.0f;
-		HoldProgress = 0.0f;
+	UE_LOG(LogGroundItemPickupManager, Log, TEXT("GroundItemPickupManager: Hold completed for item %d"), CompletedItemID);
+	return CompletedItemID;
+}
 
-		UE_LOG(LogGroundItemPickupManager, Log, TEXT("GroundItemPickupManager: Hold completed, item equipped"));
-		return true; // Completed
+float FGroundItemPickupManager::GetHoldProgress() const
+{
+	if (!bIsHoldingForGroundItem || !WorldContext)
+	{
+		return 0.0f;
 	}
 
-	return false; // Still in progress
+	const float Elapsed = static_cast<float>(WorldContext->GetTimeSeconds() - HoldStartTime);
+	return FMath::Clamp(Elapsed / FMath::Max(HoldToEquipDuration, KINDA_SMALL_NUMBER), 0.0f, 1.0f);
 }
 
 void FGroundItemPickupManager::CancelHoldInteraction()
@@ -199,8 +361,6 @@ void FGroundItemPickupManager::CancelHoldInteraction()
 
 	bIsHoldingForGroundItem = false;
 	CurrentHoldItemID = -1;
-	HoldElapsedTime = 0.0f;
-	HoldProgress = 0.0f;
 
 	UE_LOG(LogTemp, Log, TEXT("GroundItemPickupManager: Hold interaction cancelled for item %d"), CancelledItemID);
 }
@@ -243,6 +403,10 @@ void FGroundItemPickupManager::CacheComponents()
 
 bool FGroundItemPickupManager::PickupToInventoryInternal(int32 ItemID, FVector ClientLocation)
 {
+	// FIX: Capture location before removal (needed to return item if inventory is full)
+	const FVector* GroundLocation = CachedGroundItemSubsystem->GetItemLocation(ItemID);
+	const FVector OriginalLocation = GroundLocation ? *GroundLocation : ClientLocation;
+
 	// Remove item from ground
 	UItemInstance* Item = CachedGroundItemSubsystem->RemoveItemFromGround(ItemID);
 	if (!Item)
@@ -259,11 +423,7 @@ bool FGroundItemPickupManager::PickupToInventoryInternal(int32 ItemID, FVector C
 	}
 
 	// Failed to add - return to ground
-	const FVector* OriginalLocation = CachedGroundItemSubsystem->GetInstanceLocations().Find(ItemID);
-	if (OriginalLocation)
-	{
-		CachedGroundItemSubsystem->AddItemToGround(Item, *OriginalLocation);
-	}
+	CachedGroundItemSubsystem->AddItemToGround(Item, OriginalLocation);
 
 	UE_LOG(LogTemp, Warning, TEXT("GroundItemPickupManager: Inventory full, item returned to ground"));
 	return false;
@@ -271,8 +431,7 @@ bool FGroundItemPickupManager::PickupToInventoryInternal(int32 ItemID, FVector C
 
 bool FGroundItemPickupManager::PickupAndEquipInternal(int32 ItemID, FVector ClientLocation)
 {
-	// Remove item from ground
-	UItemInstance* Item = CachedGroundItemSubsystem->RemoveItemFromGround(ItemID);
+	UItemInstance* Item = CachedGroundItemSubsystem->GetItemByID(ItemID);
 	if (!Item)
 	{
 		UE_LOG(LogGroundItemPickupManager, Warning, TEXT("GroundItemPickupManager: Item %d not found"), ItemID);
@@ -286,14 +445,23 @@ bool FGroundItemPickupManager::PickupAndEquipInternal(int32 ItemID, FVector Clie
 		UE_LOG(LogGroundItemPickupManager, Warning, TEXT("GroundItemPickupManager: Cannot determine equipment slot for %s"), 
 			*Item->GetDisplayName().ToString());
 		
-		// Fallback: try inventory instead
-		if (CachedInventoryManager->AddItem(Item))
+		// Fallback: try inventory instead (still on the ground, so a full inventory leaves it there)
+		const int32 QuantityBefore = Item->Quantity;
+		if (CachedInventoryManager && CachedInventoryManager->AddItem(Item))
 		{
+			CachedGroundItemSubsystem->RemoveItemFromGround(ItemID);
 			return true;
 		}
+
+		if (Item->Quantity != QuantityBefore)
+		{
+			CachedGroundItemSubsystem->NotifyItemChanged(ItemID);
+		}
 		return false;
 	}
 
+	CachedGroundItemSubsystem->RemoveItemFromGround(ItemID);
+
 	// Try to equip (will swap to inventory if slot occupied and bSwapToBag = true)
 	CachedEquipmentManager->EquipItem(Item, TargetSlot, true);
 	
@@ -3,6 +3,7 @@
 #include "Character/Component/Interaction/InteractionManager.h"
 #include "Interactable/Interface/Interactable.h"
 #include "Interactable/Component/InteractableManager.h"
+#include "Interactable/Subsystem/InteractableRegistrySubsystem.h"
 #include "Interactable/Widget/InteractableWidget.h"
 #include "Tower/Subsystem/GroundItemSubsystem.h"
 #include "Item/ItemInstance.h"
@@ -20,12 +21,13 @@ DEFINE_LOG_CATEGORY(LogInteractionManager);
 UInteractionManager::UInteractionManager()
 {
 	PrimaryComponentTick.bCanEverTick = false; 
-	SetIsReplicatedByDefault(false);
+
+	// No replicated properties - replicated only so pickup RPCs can route
+	SetIsReplicatedByDefault(true);
 	
 	CurrentGroundItemID = -1;
 	bSystemInitialized = false;
 	bIsHolding = false;
-	LastHoldProgress = -1.0f;
 }
 
 void UInteractionManager::BeginPlay()
@@ -84,16 +86,10 @@ void UInteractionManager::Initialize()
 	// Public initialization function (for manual setup if needed)
 	if (bInteractionEnabled)
 	{
-		GetWorld()->GetTimerManager().SetTimer(
-			InteractionCheckTimer,
-			this,
-			&UInteractionManager::CheckForInteractables,
-			TraceManager.CheckFrequency,
-			true
-		);
+		ScheduleNextScan();
 
 		UE_LOG(LogInteractionManager, Log, TEXT("InteractionManager: Manually initialized on %s (Frequency: %.2fs)"), 
-			*GetOwner()->GetName(), TraceManager.CheckFrequency);
+			*GetOwner()->GetName(), TraceManager.GetNextScanDelay());
 	}
 }
 
@@ -108,10 +104,14 @@ void UInteractionManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	if (GetWorld())
 	{
 		GetWorld()->GetTimerManager().ClearTimer(InteractionCheckTimer);
-		GetWorld()->GetTimerManager().ClearTimer(HoldProgressTimer);
+		GetWorld()->GetTimerManager().ClearTimer(HoldCompleteTimer);
+		GetWorld()->GetTimerManager().ClearTimer(PredictionExpiryTimer);
 		GetWorld()->GetTimerManager().ClearTimer(PossessionCheckTimer);
 	}
 
+	UnbindScanTriggers();
+	TraceManager.Shutdown();
+
 	// End focus on current interactable
 	if (CurrentInteractable.GetInterface())
 	{
@@ -146,7 +146,28 @@ void UInteractionManager::OnInteractPressed()
 		if (InteractableComp)
 		{
 			AActor* TargetActor = InteractableComp->GetOwner();
-			InteractWithActor(TargetActor);
+
+			// Hold and mash progress live on the interactable (timestamps, no tick here)
+			switch (IInteractable::Execute_GetInteractionType(InteractableComp))
+			{
+			case EInteractionType::IT_Hold:
+				if (ValidateActorTarget(TargetActor))
+				{
+					InteractableComp->BeginHold(GetOwner());
+				}
+				break;
+
+			case EInteractionType::IT_Mash:
+				if (ValidateActorTarget(TargetActor))
+				{
+					InteractableComp->RegisterMashPress(GetOwner());
+				}
+				break;
+
+			default:
+				InteractWithActor(TargetActor);
+				break;
+			}
 			return;
 		}
 	}
@@ -157,18 +178,18 @@ void UInteractionManager::OnInteractPressed()
 		// Start hold interaction
 		PickupManager.StartHoldInteraction(CurrentGroundItemID);
 		bIsHolding = true;
-		LastHoldProgress = 0.0f;
 		
-		// Update widget to holding state
+		// Update widget to holding state (it samples GetCurrentHoldProgress while visible)
 		SetWidgetHoldingState(0.0f);
+		OnHoldProgressChanged.Broadcast(0.0f);
 		
-		// Start timer for hold progress updates (60 FPS)
+		// OPTIMIZATION: One completion timer - progress comes from the start time, not a 60 Hz accumulator
 		GetWorld()->GetTimerManager().SetTimer(
-			HoldProgressTimer,
+			HoldCompleteTimer,
 			this,
-			&UInteractionManager::UpdateHoldProgress,
-			0.016f, // ~60 FPS
-			true    // Loop
+			&UInteractionManager::OnGroundItemHoldComplete,
+			FMath::Max(PickupManager.HoldToEquipDuration, KINDA_SMALL_NUMBER),
+			false
 		);
 		
 		UE_LOG(LogInteractionManager, Verbose, TEXT("InteractionManager: Started hold interaction for item %d"), CurrentGroundItemID);
@@ -182,14 +203,23 @@ void UInteractionManager::OnInteractReleased()
 		return;
 	}
 
+	// Actor hold released early (mash has nothing to do on release)
+	UInteractableManager* InteractableComp = Cast<UInteractableManager>(CurrentInteractable.GetObject());
+	if (InteractableComp && InteractableComp->IsHoldActive())
+	{
+		InteractableComp->ReleaseHold(GetOwner());
+		return;
+	}
+
 	// If holding for ground item, check if it was a tap (quick release)
 	if (PickupManager.IsHoldingForGroundItem())
 	{
 		float HoldProgress = PickupManager.GetHoldProgress();
 		
-		// Stop the hold progress timer
-		GetWorld()->GetTimerManager().ClearTimer(HoldProgressTimer);
+		// Stop the hold completion timer
+		GetWorld()->GetTimerManager().ClearTimer(HoldCompleteTimer);
 		bIsHolding = false;
+		OnHoldProgressChanged.Broadcast(0.0f);
 		
 		// If progress < threshold, treat as tap (pickup to inventory)
 		if (HoldProgress < TapThreshold)
@@ -224,10 +254,169 @@ void UInteractionManager::PickupAllNearbyItems()
 		return;
 	}
 
-	// Pickup all in radius
-	int32 PickedUpCount = PickupManager.PickupAllNearby(CameraLocation);
+	// Around the pawn - the server validates distance from the pawn, not the camera
+	AActor* Owner = GetOwner();
+	TArray<int32> ItemIDs;
+	if (!Owner || PickupManager.GatherNearbyItemIDs(Owner->GetActorLocation(), ItemIDs) == 0)
+	{
+		return;
+	}
+
+	// OPTIMIZATION: One request for the whole area, not one per item
+	RequestPickup(ItemIDs);
+}
+
+void UInteractionManager::RequestPickup(const TArray<int32>& ItemIDs)
+{
+	if (GetOwner()->HasAuthority())
+	{
+		FGroundItemPickupResult Result;
+		PickupItemsBatch(ItemIDs, Result);
+		HandlePickupResult(Result);
+		return;
+	}
+
+	// OPTIMIZATION: Predict - items vanish now, not a round trip later, and spam clicks send nothing new
+	TArray<int32> PredictedIDs;
+	const int32 RequestID = PredictPickup(ItemIDs, PredictedIDs);
+	if (RequestID != INDEX_NONE)
+	{
+		ServerPickupItems(RequestID, PredictedIDs);
+	}
+}
+
+int32 UInteractionManager::PredictPickup(const TArray<int32>& ItemIDs, TArray<int32>& OutPredictedIDs)
+{
+	const int32 RequestID = PickupManager.BeginPredictedPickup(ItemIDs, OutPredictedIDs);
+	if (RequestID == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	if (OutPredictedIDs.Contains(CurrentGroundItemID))
+	{
+		UpdateGroundItemFocus(-1);
+	}
+
+	// A lost answer must not leave items hidden forever
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	if (!TimerManager.IsTimerActive(PredictionExpiryTimer))
+	{
+		const UGroundItemSubsystem* GroundItems = GetWorld()->GetSubsystem<UGroundItemSubsystem>();
+		TimerManager.SetTimer(PredictionExpiryTimer, this, &UInteractionManager::ExpirePredictedPickups,
+			GroundItems ? GroundItems->PredictedRemovalTimeout : 5.0f, false);
+	}
+
+	OnGroundItemsPickupPending.Broadcast(OutPredictedIDs);
+	return RequestID;
+}
+
+void UInteractionManager::ExpirePredictedPickups()
+{
+	TArray<int32> RolledBackIDs;
+	const float NextExpiry = PickupManager.ExpirePredictedPickups(RolledBackIDs);
+
+	if (RolledBackIDs.Num() > 0)
+	{
+		OnGroundItemsPickupRolledBack.Broadcast(RolledBackIDs);
+	}
+
+	if (NextExpiry > 0.0f)
+	{
+		GetWorld()->GetTimerManager().SetTimer(PredictionExpiryTimer, this, &UInteractionManager::ExpirePredictedPickups, NextExpiry, false);
+	}
+}
+
+void UInteractionManager::ServerPickupItems_Implementation(int32 RequestID, const TArray<int32>& ItemIDs)
+{
+	FGroundItemPickupResult Result;
+	Result.RequestID = RequestID;
+	PickupItemsBatch(ItemIDs, Result);
+	ClientPickupItemsResult(Result);
+}
+
+void UInteractionManager::ServerPickupAndEquip_Implementation(int32 RequestID, int32 ItemID)
+{
+	EnsureServerManagers();
+
+	FGroundItemPickupResult Result;
+	Result.RequestID = RequestID;
+	Result.NumRequested = 1;
+
+	TArray<int32> ValidIDs;
+	ValidatorManager.ValidateGroundItemBatch({ ItemID }, GetOwner()->GetActorLocation(), PickupManager.PickupRadius, ValidIDs);
+
+	if (ValidIDs.Num() == 0)
+	{
+		Result.NumRejected = 1;
+	}
+	else if (PickupManager.PickupAndEquip(ItemID))
+	{
+		Result.PickedUpItemIDs.Add(ItemID);
+	}
+	else
+	{
+		Result.NumReturned = 1;
+	}
+
+	ClientPickupItemsResult(Result);
+}
+
+void UInteractionManager::ClientPickupItemsResult_Implementation(const FGroundItemPickupResult& Result)
+{
+	// Confirm or roll back what this request hid
+	TArray<int32> RolledBackIDs;
+	PickupManager.ResolvePredictedPickup(Result.RequestID, Result.PickedUpItemIDs, RolledBackIDs);
+
+	if (RolledBackIDs.Num() > 0)
+	{
+		// Restored items re-enter through OnGroundItemAdded, which also triggers a rescan
+		OnGroundItemsPickupRolledBack.Broadcast(RolledBackIDs);
+	}
 
-	UE_LOG(LogInteractionManager, Log, TEXT("InteractionManager: Picked up %d items from area"), PickedUpCount);
+	HandlePickupResult(Result);
+}
+
+void UInteractionManager::PickupItemsBatch(const TArray<int32>& ItemIDs, FGroundItemPickupResult& OutResult)
+{
+	EnsureServerManagers();
+
+	OutResult.NumRequested = ItemIDs.Num();
+
+	// Oversized requests are cut, not trusted
+	TArray<int32> RequestedIDs(ItemIDs.GetData(), FMath::Min(ItemIDs.Num(), PickupManager.MaxBatchPickup));
+
+	TArray<int32> ValidIDs;
+	ValidatorManager.ValidateGroundItemBatch(RequestedIDs, GetOwner()->GetActorLocation(), PickupManager.PickupRadius, ValidIDs);
+	OutResult.NumRejected = ItemIDs.Num() - ValidIDs.Num();
+
+	PickupManager.PickupItemsToInventory(ValidIDs, OutResult);
+
+	UE_LOG(LogInteractionManager, Log, TEXT("InteractionManager: Picked up %d/%d items from area (rejected %d, returned %d)"),
+		OutResult.PickedUpItemIDs.Num(), OutResult.NumRequested, OutResult.NumRejected, OutResult.NumReturned);
+}
+
+void UInteractionManager::HandlePickupResult(const FGroundItemPickupResult& Result)
+{
+	if (Result.PickedUpItemIDs.Contains(CurrentGroundItemID))
+	{
+		UpdateGroundItemFocus(-1);
+	}
+
+	OnGroundItemsPickedUp.Broadcast(Result);
+}
+
+void UInteractionManager::EnsureServerManagers()
+{
+	// Locally controlled pawns already did this in InitializeSubManagers
+	if (bSystemInitialized || bServerManagersInitialized)
+	{
+		return;
+	}
+
+	ValidatorManager.Initialize(GetOwner(), GetWorld());
+	PickupManager.Initialize(GetOwner(), GetWorld());
+	bServerManagersInitialized = true;
 }
 
 void UInteractionManager::CheckForInteractables()
@@ -245,28 +434,173 @@ void UInteractionManager::CheckForInteractables()
 		return;
 	}
 
-	// Get camera location for debug visualization
-	FVector CameraLocation;
-	FRotator CameraRotation;
-	TraceManager.GetCameraViewPoint(CameraLocation, CameraRotation);
+	// Last scan's traces are still out - its FinishAsyncScan will report
+	if (bAsyncScanInFlight)
+	{
+		return;
+	}
 
-	// ═══════════════════════════════════════════════
-	// DEBUG: Draw interaction range sphere
-	// ═══════════════════════════════════════════════
-	if (bDebugEnabled)
+	// OPTIMIZATION: View hasn't changed enough - nothing new to find
+	if (!TraceManager.ShouldScan())
 	{
-		DebugManager.DrawInteractionRange(CameraLocation, TraceManager.InteractionDistance);
+		return;
+	}
+
+	// Scored broadphase over interactables + ground items, LOS for the best few
+	if (TraceManager.bUseCandidateScoring)
+	{
+		TraceManager.GatherFocusCandidates();
+
+		// OPTIMIZATION: LOS traces run off the game thread, result is read next tick
+		if (TraceManager.bUseAsyncTrace && TraceManager.RequestCandidateTraces())
+		{
+			bAsyncScanInFlight = true;
+			GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UInteractionManager::FinishAsyncScan);
+			return;
+		}
+
+		TScriptInterface<IInteractable> NewInteractable;
+		int32 NewGroundItemID = INDEX_NONE;
+		TraceManager.ResolveFocusCandidates(NewInteractable, NewGroundItemID);
+		FinishCandidateScan(NewInteractable, NewGroundItemID);
+		return;
 	}
 
 	// PRIORITY 1: Check for actor-based interactables
-	TScriptInterface<IInteractable> NewInteractable = TraceManager.TraceForActorInteractable();
+	if (!TraceManager.bUseAsyncTrace)
+	{
+		TScriptInterface<IInteractable> NewInteractable = TraceManager.TraceForActorInteractable();
+		FinishScan(NewInteractable, FindGroundItemFallback(NewInteractable));
+		return;
+	}
+
+	// OPTIMIZATION: Trace runs off the game thread, result is read next tick
+	if (TraceManager.RequestAsyncActorTrace())
+	{
+		bAsyncScanInFlight = true;
+		GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UInteractionManager::FinishAsyncScan);
+		return;
+	}
+
+	// Nothing in range - no trace issued
+	TScriptInterface<IInteractable> NewInteractable = TraceManager.LatchFocus(TScriptInterface<IInteractable>());
+	FinishScan(NewInteractable, FindGroundItemFallback(NewInteractable));
+}
+
+void UInteractionManager::RequestImmediateScan()
+{
+	// Several triggers in one frame share one scan
+	if (TraceManager.RequestScan() && GetWorld())
+	{
+		GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UInteractionManager::RunScheduledScan);
+	}
+}
+
+void UInteractionManager::RunScheduledScan()
+{
+	CheckForInteractables();
+
+	// OPTIMIZATION: One-shot timer - a still view sleeps for the idle back-off instead of
+	// waking at FastScanInterval just to be told to skip. Always re-armed, so disabling or
+	// holding only pauses scans; RequestImmediateScan covers event wakeups in between.
+	ScheduleNextScan();
+}
+
+void UInteractionManager::ScheduleNextScan()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().SetTimer(
+			InteractionCheckTimer,
+			this,
+			&UInteractionManager::RunScheduledScan,
+			TraceManager.GetNextScanDelay(),
+			false
+		);
+	}
+}
+
+void UInteractionManager::FinishAsyncScan()
+{
+	// State may have changed while the trace was in flight
+	if (!bInteractionEnabled || bIsHolding)
+	{
+		bAsyncScanInFlight = false;
+		return;
+	}
+
+	TScriptInterface<IInteractable> NewInteractable;
+	int32 NewGroundItemID = INDEX_NONE;
+
+	const bool bFinished = TraceManager.bUseCandidateScoring
+		? TraceManager.ConsumeCandidateTraces(NewInteractable, NewGroundItemID)
+		: TraceManager.ConsumeAsyncActorTrace(NewInteractable);
 
+	// Still in flight - look again next tick (the trace manager falls back to a sync trace if it never arrives)
+	if (!bFinished)
+	{
+		GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UInteractionManager::FinishAsyncScan);
+		return;
+	}
+
+	bAsyncScanInFlight = false;
+
+	if (TraceManager.bUseCandidateScoring)
+	{
+		FinishCandidateScan(NewInteractable, NewGroundItemID);
+		return;
+	}
+
+	FinishScan(NewInteractable, FindGroundItemFallback(NewInteractable));
+}
+
+void UInteractionManager::FinishCandidateScan(const TScriptInterface<IInteractable>& NewInteractable, int32 NewGroundItemID)
+{
+	// A ground item won outright - don't let a latched actor steal focus back
+	if (NewGroundItemID != INDEX_NONE)
+	{
+		TraceManager.ResetFocusLatch();
+		FinishScan(NewInteractable, NewGroundItemID);
+		return;
+	}
+
+	if (NewInteractable.GetInterface())
+	{
+		FinishScan(TraceManager.LatchFocus(NewInteractable), INDEX_NONE);
+		return;
+	}
+
+	// Nothing visible in the broadphase - the registry only knows UInteractableManager owners,
+	// so the center ray still finds actors implementing IInteractable themselves
+	const TScriptInterface<IInteractable> RayInteractable = TraceManager.TraceForActorInteractable();
+	FinishScan(RayInteractable, FindGroundItemFallback(RayInteractable));
+}
+
+int32 UInteractionManager::FindGroundItemFallback(const TScriptInterface<IInteractable>& NewInteractable)
+{
 	// PRIORITY 2: Check for ground items (if no actor found)
 	int32 NewGroundItemID = -1;
 	if (!NewInteractable.GetInterface())
 	{
 		TraceManager.FindNearestGroundItem(NewGroundItemID);
 	}
+	return NewGroundItemID;
+}
+
+void UInteractionManager::FinishScan(const TScriptInterface<IInteractable>& NewInteractable, int32 NewGroundItemID)
+{
+	// Get camera location for debug visualization
+	FVector CameraLocation;
+	FRotator CameraRotation;
+	TraceManager.GetCameraViewPoint(CameraLocation, CameraRotation);
+
+	// ═══════════════════════════════════════════════
+	// DEBUG: Draw interaction range sphere
+	// ═══════════════════════════════════════════════
+	if (bDebugEnabled)
+	{
+		DebugManager.DrawInteractionRange(CameraLocation, TraceManager.InteractionDistance);
+	}
 
 	// Update actor interactable state
 	if (NewInteractable != CurrentInteractable)
@@ -319,8 +653,7 @@ void UInteractionManager::CheckForInteractables()
 			// Get ground item location from subsystem
 			if (UGroundItemSubsystem* Subsystem = GetWorld()->GetSubsystem<UGroundItemSubsystem>())
 			{
-				const TMap<int32, FVector>& Locations = Subsystem->GetInstanceLocations();
-				if (const FVector* LocationPtr = Locations.Find(CurrentGroundItemID))
+				if (const FVector* LocationPtr = Subsystem->GetItemLocation(CurrentGroundItemID))
 				{
 					DebugManager.DrawGroundItem(*LocationPtr, CurrentGroundItemID);
 				}
@@ -406,16 +739,12 @@ void UInteractionManager::InitializeInteractionSystem()
 	// Start interaction check timer
 	if (bInteractionEnabled)
 	{
-		GetWorld()->GetTimerManager().SetTimer(
-			InteractionCheckTimer,
-			this,
-			&UInteractionManager::CheckForInteractables,
-			TraceManager.CheckFrequency,
-			true
-		);
+		ScheduleNextScan();
 
 		UE_LOG(LogInteractionManager, Log, TEXT("InteractionManager: ✓ Initialized on %s (Frequency: %.2fs)"), 
-			*GetOwner()->GetName(), TraceManager.CheckFrequency);
+			*GetOwner()->GetName(), TraceManager.GetNextScanDelay());
+
+		BindScanTriggers();
 	}
 	
 	bSystemInitialized = true;
@@ -468,6 +797,105 @@ void UInteractionManager::InitializeSubManagers()
 	UE_LOG(LogInteractionManager, Log, TEXT("InteractionManager: All sub-managers initialized"));
 }
 
+void UInteractionManager::BindScanTriggers()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	if (UGroundItemSubsystem* GroundItems = World->GetSubsystem<UGroundItemSubsystem>())
+	{
+		if (!GroundItemAddedHandle.IsValid())
+		{
+			GroundItemAddedHandle = GroundItems->OnGroundItemAdded.AddUObject(this, &UInteractionManager::OnGroundItemAdded);
+		}
+
+		if (!GroundItemRemovedHandle.IsValid())
+		{
+			GroundItemRemovedHandle = GroundItems->OnGroundItemRemoved.AddUObject(this, &UInteractionManager::OnGroundItemRemoved);
+		}
+	}
+
+	if (UInteractableRegistrySubsystem* Registry = World->GetSubsystem<UInteractableRegistrySubsystem>())
+	{
+		if (!InteractableAvailableHandle.IsValid())
+		{
+			InteractableAvailableHandle = Registry->OnInteractableAvailable.AddUObject(this, &UInteractionManager::OnInteractableAvailable);
+		}
+
+		if (!InteractableUnavailableHandle.IsValid())
+		{
+			InteractableUnavailableHandle = Registry->OnInteractableUnavailable.AddUObject(this, &UInteractionManager::OnInteractableUnavailable);
+		}
+	}
+}
+
+void UInteractionManager::UnbindScanTriggers()
+{
+	UWorld* World = GetWorld();
+
+	if (UGroundItemSubsystem* GroundItems = World ? World->GetSubsystem<UGroundItemSubsystem>() : nullptr)
+	{
+		GroundItems->OnGroundItemAdded.Remove(GroundItemAddedHandle);
+		GroundItems->OnGroundItemRemoved.Remove(GroundItemRemovedHandle);
+	}
+
+	if (UInteractableRegistrySubsystem* Registry = World ? World->GetSubsystem<UInteractableRegistrySubsystem>() : nullptr)
+	{
+		Registry->OnInteractableAvailable.Remove(InteractableAvailableHandle);
+		Registry->OnInteractableUnavailable.Remove(InteractableUnavailableHandle);
+	}
+
+	GroundItemAddedHandle.Reset();
+	GroundItemRemovedHandle.Reset();
+	InteractableAvailableHandle.Reset();
+	InteractableUnavailableHandle.Reset();
+}
+
+void UInteractionManager::OnGroundItemAdded(int32 ItemID, const FVector& Location)
+{
+	if (TraceManager.IsNearLastScan(Location))
+	{
+		RequestImmediateScan();
+	}
+}
+
+void UInteractionManager::OnGroundItemRemoved(int32 ItemID, const FVector& Location)
+{
+	// Focused item gone, or the next-best one nearby may now win
+	if (ItemID == CurrentGroundItemID || TraceManager.IsNearLastScan(Location))
+	{
+		RequestImmediateScan();
+	}
+}
+
+void UInteractionManager::OnInteractableAvailable(UInteractableManager* Interactable)
+{
+	const AActor* InteractableOwner = Interactable ? Interactable->GetOwner() : nullptr;
+	if (InteractableOwner && TraceManager.IsNearLastScan(InteractableOwner->GetActorLocation()))
+	{
+		RequestImmediateScan();
+	}
+}
+
+void UInteractionManager::OnInteractableUnavailable(UInteractableManager* Interactable)
+{
+	const bool bIsFocused = Interactable && CurrentInteractable.GetObject() == Interactable;
+	if (bIsFocused)
+	{
+		// Don't let the latch hold on to something that can no longer be used
+		TraceManager.ResetFocusLatch();
+	}
+
+	const AActor* InteractableOwner = Interactable ? Interactable->GetOwner() : nullptr;
+	if (bIsFocused || (InteractableOwner && TraceManager.IsNearLastScan(InteractableOwner->GetActorLocation())))
+	{
+		RequestImmediateScan();
+	}
+}
+
 void UInteractionManager::InitializeWidget()
 {
 	// Need a valid widget class
@@ -531,32 +959,17 @@ void UInteractionManager::InteractWithActor(AActor* TargetActor)
 		return;
 	}
 
-	// Get client location for validation
 	AActor* Owner = GetOwner();
-	if (!Owner)
+	if (!Owner || !ValidateActorTarget(TargetActor))
 	{
 		return;
 	}
 
-	FVector ClientLocation = Owner->GetActorLocation();
-
-	// Validate interaction (server-side)
-	if (ValidatorManager.HasAuthority())
-	{
-		if (!ValidatorManager.ValidateActorInteraction(TargetActor, ClientLocation, TraceManager.InteractionDistance))
-		{
-			UE_LOG(LogInteractionManager, Warning, TEXT("InteractionManager: Actor interaction failed validation"));
-			
-			if (bDebugEnabled)
-			{
-				DebugManager.LogInteraction(GetCurrentInteractable(), false, "Validation failed");
-			}
-			return;
-		}
-	}
-
 	// Execute interaction
-	UInteractableManager* InteractableComp = TargetActor->FindComponentByClass<UInteractableManager>();
+	UInteractableRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UInteractableRegistrySubsystem>();
+	UInteractableManager* InteractableComp = Registry
+		? Registry->FindInteractable(TargetActor)
+		: TargetActor->FindComponentByClass<UInteractableManager>();
 	if (InteractableComp)
 	{
 		IInteractable::Execute_OnInteract(InteractableComp, Owner);
@@ -572,8 +985,39 @@ void UInteractionManager::InteractWithActor(AActor* TargetActor)
 	}
 }
 
+bool UInteractionManager::ValidateActorTarget(AActor* TargetActor)
+{
+	AActor* Owner = GetOwner();
+	if (!TargetActor || !Owner)
+	{
+		return false;
+	}
+
+	// Validate interaction (server-side)
+	if (ValidatorManager.HasAuthority() &&
+		!ValidatorManager.ValidateActorInteraction(TargetActor, Owner->GetActorLocation(), TraceManager.InteractionDistance))
+	{
+		UE_LOG(LogInteractionManager, Warning, TEXT("InteractionManager: Actor interaction failed validation"));
+
+		if (bDebugEnabled)
+		{
+			DebugManager.LogInteraction(GetCurrentInteractable(), false, "Validation failed");
+		}
+		return false;
+	}
+
+	return true;
+}
+
 void UInteractionManager::PickupGroundItemToInventory(int32 ItemID)
 {
+	// Clients have no item instances - go through the predicted server batch
+	if (!GetOwner()->HasAuthority())
+	{
+		RequestPickup({ ItemID });
+		return;
+	}
+
 	bool bSuccess = PickupManager.PickupToInventory(ItemID);
 	
 	if (bDebugEnabled)
@@ -590,6 +1034,18 @@ void UInteractionManager::PickupGroundItemToInventory(int32 ItemID)
 
 void UInteractionManager::PickupGroundItemAndEquip(int32 ItemID)
 {
+	// Same predicted round trip as a tap, answered with the same result RPC
+	if (!GetOwner()->HasAuthority())
+	{
+		TArray<int32> PredictedIDs;
+		const int32 RequestID = PredictPickup({ ItemID }, PredictedIDs);
+		if (RequestID != INDEX_NONE)
+		{
+			ServerPickupAndEquip(RequestID, ItemID);
+		}
+		return;
+	}
+
 	bool bSuccess = PickupManager.PickupAndEquip(ItemID);
 	
 	if (bDebugEnabled)
@@ -637,40 +1093,26 @@ void UInteractionManager::UpdateGroundItemFocus(int32 NewGroundItemID)
 	}
 }
 
-void UInteractionManager::UpdateHoldProgress()
+void UInteractionManager::OnGroundItemHoldComplete()
 {
-	// Update hold progress via timer (called at 60 FPS)
-	bool bCompleted = PickupManager.UpdateHoldProgress(0.016f);
-	
-	float CurrentProgress = PickupManager.GetHoldProgress();
-	
-	// Update widget progress (only if changed significantly)
-	if (FMath::Abs(CurrentProgress - LastHoldProgress) > 0.005f)
+	// Ends the hold without equipping - equip goes through PickupGroundItemAndEquip (debug + focus)
+	const int32 ItemID = PickupManager.CompleteHoldInteraction();
+	bIsHolding = false;
+
+	if (ItemID == -1)
 	{
-		LastHoldProgress = CurrentProgress;
-		SetWidgetHoldingState(CurrentProgress);
-		
-		// Broadcast progress change
-		OnHoldProgressChanged.Broadcast(CurrentProgress);
+		return;
 	}
+
+	OnHoldProgressChanged.Broadcast(1.0f);
+
+	// Execute equip
+	PickupGroundItemAndEquip(ItemID);
 	
-	if (bCompleted)
-	{
-		// Hold completed - equip the item
-		int32 ItemID = PickupManager.GetCurrentHoldItemID();
-		
-		// Stop timer
-		GetWorld()->GetTimerManager().ClearTimer(HoldProgressTimer);
-		bIsHolding = false;
-		
-		// Execute equip
-		PickupGroundItemAndEquip(ItemID);
-		
-		// Widget shows completed state
-		SetWidgetCompletedState();
-		
-		UE_LOG(LogInteractionManager, Log, TEXT("InteractionManager: Hold interaction completed - equipped item %d"), ItemID);
-	}
+	// Widget shows completed state
+	SetWidgetCompletedState();
+	
+	UE_LOG(LogInteractionManager, Log, TEXT("InteractionManager: Hold interaction completed - equipped item %d"), ItemID);
 }
 
 // ═══════════════════════════════════════════════════════════════════════
@@ -739,6 +1181,7 @@ void UInteractionManager::SetWidgetHoldingState(float Progress)
 
 	InteractionWidget->SetWidgetState(EInteractionWidgetState::IWS_Holding);
 	InteractionWidget->SetProgress(Progress);
+	InteractionWidget->SetProgressSampler(FInteractionProgressSampler::CreateUObject(this, &UInteractionManager::GetCurrentHoldProgress));
 }
 
 void UInteractionManager::SetWidgetCompletedState()
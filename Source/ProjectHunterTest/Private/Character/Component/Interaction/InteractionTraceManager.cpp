@@ -3,7 +3,9 @@
 #include "Character/Component/Interaction/InteractionTraceManager.h"
 #include "Interactable/Interface/Interactable.h"
 #include "Interactable/Component/InteractableManager.h"
+#include "Interactable/Subsystem/InteractableRegistrySubsystem.h"
 #include "Tower/Subsystem/GroundItemSubsystem.h"
+#include "Tower/Actors/ISMContainerActor.h"
 #include "Item/ItemInstance.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
@@ -17,6 +19,24 @@ FInteractionTraceManager::FInteractionTraceManager()
 	: InteractionDistance(300.0f)
 	, CheckFrequency(0.1f)
 	, InteractionTraceChannel(ECC_Visibility)
+	, bSkipTraceWhenNoneNearby(true)
+	, RegistryQueryMargin(300.0f)
+	, bUseAsyncTrace(true)
+	, FocusLatchTime(0.15f)
+	, bAdaptiveScan(true)
+	, ScanMoveThreshold(5.0f)
+	, ScanRotationThreshold(1.0f)
+	, FastRotationSpeed(120.0f)
+	, FastScanInterval(0.033f)
+	, IdleScanInterval(0.5f)
+	, bUseCandidateScoring(true)
+	, FocusConeAngle(20.0f)
+	, GroundItemConeAngle(60.0f)
+	, AngleWeight(0.6f)
+	, DistanceWeight(0.3f)
+	, PriorityWeight(0.1f)
+	, MaxLOSChecks(3)
+	, GroundItemLOSHeight(10.0f)
 	, bUseALSCameraOrigin(true)
 	, OffsetForward(0.0f)
 	, OffsetRight(0.0f)
@@ -26,6 +46,21 @@ FInteractionTraceManager::FInteractionTraceManager()
 	, CachedPlayerController(nullptr)
 	, CachedALSCameraManager(nullptr)
 	, CachedGroundItemSubsystem(nullptr)
+	, CachedInteractableRegistry(nullptr)
+	, DebugManager(nullptr)
+	, PendingTraceStart(FVector::ZeroVector)
+	, PendingTraceEnd(FVector::ZeroVector)
+	, AsyncTraceWaitTicks(0)
+	, LastFocusHitTime(0.0f)
+	, CandidateOrigin(FVector::ZeroVector)
+	, CandidateForward(FVector::ForwardVector)
+	, LastScanLocation(FVector::ZeroVector)
+	, LastScanRotation(FQuat::Identity)
+	, LastScanTime(-1.0f)
+	, CurrentIdleInterval(0.0f)
+	, NextScanDelay(0.0f)
+	, bScanRequested(true)
+	, GroundProximityQueryHandle(INDEX_NONE)
 {
 }
 
@@ -50,6 +85,19 @@ void FInteractionTraceManager::SetDebugManager(FInteractionDebugManager* InDebug
 	DebugManager = InDebugManager;
 }
 
+void FInteractionTraceManager::Shutdown()
+{
+	if (CachedGroundItemSubsystem && GroundProximityQueryHandle != INDEX_NONE)
+	{
+		CachedGroundItemSubsystem->UnregisterProximityQuery(GroundProximityQueryHandle);
+	}
+
+	GroundProximityQueryHandle = INDEX_NONE;
+	PendingTraceHandle.Invalidate();
+	LatchedInteractable.Reset();
+	FocusCandidates.Reset();
+}
+
 // ═══════════════════════════════════════════════════════════════════════
 // PRIMARY FUNCTIONS
 // ═══════════════════════════════════════════════════════════════════════
@@ -58,67 +106,103 @@ void FInteractionTraceManager::SetDebugManager(FInteractionDebugManager* InDebug
 
 TScriptInterface<IInteractable> FInteractionTraceManager::TraceForActorInteractable()
 {
-	TScriptInterface<IInteractable> Result;
-
-	// Get camera view
-	FVector CameraLocation;
-	FRotator CameraRotation;
-	if (!GetCameraViewPoint(CameraLocation, CameraRotation))
+	FVector TraceStart;
+	FVector TraceEnd;
+	if (!GetFocusTraceSegment(TraceStart, TraceEnd))
 	{
-		return Result;
+		return LatchFocus(TScriptInterface<IInteractable>());
 	}
 
-	// Calculate trace points
-	FVector TraceStart = GetTraceStartLocation(CameraLocation, CameraRotation);
-	FVector TraceEnd = GetTraceEndLocation(CameraLocation, CameraRotation);
-
 	// Perform line trace
 	FHitResult HitResult;
-	bool bHit = PerformLineTrace(TraceStart, TraceEnd, HitResult);
-    
-	// ═══════════════════════════════════════════════════════════════
-	// DEBUG VISUALIZATION - Draw immediately after trace
-	// ═══════════════════════════════════════════════════════════════
-	if (DebugManager)
+	const bool bHit = PerformLineTrace(TraceStart, TraceEnd, HitResult);
+
+	return LatchFocus(ResolveTraceHit(bHit, HitResult, TraceStart, TraceEnd));
+}
+
+bool FInteractionTraceManager::RequestAsyncActorTrace()
+{
+	PendingTraceHandle.Invalidate();
+	AsyncTraceWaitTicks = 0;
+
+	if (!WorldContext || !GetFocusTraceSegment(PendingTraceStart, PendingTraceEnd))
 	{
-		DebugManager->DrawTraceLine(TraceStart, TraceEnd, bHit);
-        
-		if (bHit)
-		{
-			DebugManager->DrawHitPoint(HitResult.Location, HitResult.Normal);
-		}
+		return false;
 	}
 
-	// Early exit if no hit
-	if (!bHit)
+	// OPTIMIZATION: Runs on the physics task graph - no game-thread trace cost
+	PendingTraceHandle = WorldContext->AsyncLineTraceByChannel(
+		EAsyncTraceType::Single,
+		PendingTraceStart,
+		PendingTraceEnd,
+		InteractionTraceChannel,
+		MakeTraceQueryParams()
+	);
+
+	return true;
+}
+
+bool FInteractionTraceManager::ConsumeAsyncActorTrace(TScriptInterface<IInteractable>& OutInteractable)
+{
+	if (!WorldContext)
 	{
-		return Result;
+		return false;
 	}
 
-	// Check if hit actor is interactable
-	AActor* HitActor = HitResult.GetActor();
-	if (!IsActorInteractable(HitActor))
+	// Nothing in flight - trace the current view now
+	if (!PendingTraceHandle.IsValid())
 	{
-		return Result;
+		OutInteractable = TraceForActorInteractable();
+		return true;
 	}
 
-	// Try component first
-	if (UInteractableManager* InteractableComp = HitActor->FindComponentByClass<UInteractableManager>())
+	FTraceDatum TraceData;
+	const bool bReady = WorldContext->QueryTraceData(PendingTraceHandle, TraceData);
+
+	// Not back yet - wait a tick or two, then stop waiting and trace here
+	if (!bReady && AsyncTraceWaitTicks++ < MaxAsyncTraceWaitTicks)
 	{
-		Result.SetObject(InteractableComp);
-		Result.SetInterface(Cast<IInteractable>(InteractableComp));
+		return false;
 	}
-	// Try actor interface
-	else if (HitActor->GetClass()->ImplementsInterface(UInteractable::StaticClass()))
+
+	PendingTraceHandle.Invalidate();
+
+	FHitResult HitResult;
+	bool bHit = false;
+	if (bReady)
 	{
-		Result.SetObject(HitActor);
-		Result.SetInterface(Cast<IInteractable>(HitActor));
+		bHit = TraceData.OutHits.Num() > 0 && TraceData.OutHits[0].bBlockingHit;
+		HitResult = bHit ? TraceData.OutHits[0] : FHitResult();
+	}
+	else
+	{
+		// Result expired - trace the same segment rather than drop the scan
+		bHit = PerformLineTrace(PendingTraceStart, PendingTraceEnd, HitResult);
 	}
 
-	// Store last trace result
-	LastTraceResult = HitResult;
+	OutInteractable = LatchFocus(ResolveTraceHit(bHit, HitResult, PendingTraceStart, PendingTraceEnd));
+	return true;
+}
 
-	return Result;
+TScriptInterface<IInteractable> FInteractionTraceManager::LatchFocus(const TScriptInterface<IInteractable>& Found)
+{
+	const float Now = WorldContext ? WorldContext->GetTimeSeconds() : 0.0f;
+
+	if (Found.GetInterface())
+	{
+		LatchedInteractable = TWeakInterfacePtr<IInteractable>(Found.GetObject());
+		LastFocusHitTime = Now;
+		return Found;
+	}
+
+	// Brief miss (edge of a mesh, trace grazing a corner) - keep the old focus
+	if (LatchedInteractable.IsValid() && Now - LastFocusHitTime <= FocusLatchTime)
+	{
+		return LatchedInteractable.ToScriptInterface();
+	}
+
+	LatchedInteractable.Reset();
+	return TScriptInterface<IInteractable>();
 }
 
 UItemInstance* FInteractionTraceManager::FindNearestGroundItem(int32& OutItemID)
@@ -138,6 +222,15 @@ UItemInstance* FInteractionTraceManager::FindNearestGroundItem(int32& OutItemID)
 		return nullptr;
 	}
 
+	// Batched path: push our location, read the last batch's answer
+	if (GroundProximityQueryHandle != INDEX_NONE)
+	{
+		CachedGroundItemSubsystem->UpdateProximityQuery(GroundProximityQueryHandle, CameraLocation, InteractionDistance);
+
+		OutItemID = CachedGroundItemSubsystem->GetProximityResult(GroundProximityQueryHandle);
+		return OutItemID != INDEX_NONE ? CachedGroundItemSubsystem->GetItemByID(OutItemID) : nullptr;
+	}
+
 	// Query subsystem for nearest item
 	return CachedGroundItemSubsystem->GetNearestItem(
 		CameraLocation,
@@ -252,28 +345,401 @@ void FInteractionTraceManager::CacheComponents()
 		}
 	}
 
-	// Cache ground item subsystem
+	// Cache ground item subsystem + interactable registry
 	if (WorldContext)
 	{
+		CachedInteractableRegistry = WorldContext->GetSubsystem<UInteractableRegistrySubsystem>();
+
 		CachedGroundItemSubsystem = WorldContext->GetSubsystem<UGroundItemSubsystem>();
 		if (!CachedGroundItemSubsystem)
 		{
 			UE_LOG(LogInteractionTraceManager, Warning, TEXT("InteractionTraceManager: No GroundItemSubsystem found"));
 		}
+		else if (GroundProximityQueryHandle == INDEX_NONE)
+		{
+			GroundProximityQueryHandle = CachedGroundItemSubsystem->RegisterProximityQuery();
+		}
 	}
 }
 
-bool FInteractionTraceManager::PerformLineTrace(const FVector& Start, const FVector& End, FHitResult& OutHit)
+// ═══════════════════════════════════════════════════════════════════════
+// CANDIDATE SCORING
+// ═══════════════════════════════════════════════════════════════════════
+
+int32 FInteractionTraceManager::GatherFocusCandidates()
+{
+	FocusCandidates.Reset();
+
+	FVector CameraLocation;
+	FRotator CameraRotation;
+	if (!GetCameraViewPoint(CameraLocation, CameraRotation))
+	{
+		return 0;
+	}
+
+	CandidateOrigin = GetTraceStartLocation(CameraLocation, CameraRotation);
+	CandidateForward = CameraRotation.Vector();
+
+	// OPTIMIZATION: One radius query per index, no physics
+	// Registry holds origins - the margin lets in big actors whose surface is in reach
+	if (CachedInteractableRegistry)
+	{
+		CachedInteractableRegistry->ForEachInRadius(CandidateOrigin, InteractionDistance + RegistryQueryMargin,
+			[this](UInteractableManager* Interactable, const FVector& Location)
+			{
+				if (!Interactable->Config.bCanInteract)
+				{
+					return;
+				}
+
+				const FVector AimPoint = GetActorAimPoint(Interactable->GetOwner(), Location);
+
+				float Score;
+				if (ScoreCandidate(AimPoint, Interactable->Config.FocusPriority, FocusConeAngle, false, Score))
+				{
+					FFocusCandidate& Candidate = FocusCandidates.AddDefaulted_GetRef();
+					Candidate.Interactable = Interactable;
+					Candidate.Location = AimPoint;
+					Candidate.Score = Score;
+				}
+			});
+	}
+
+	if (CachedGroundItemSubsystem)
+	{
+		const FGroundItemStorage& Storage = CachedGroundItemSubsystem->GetStorage();
+		const float MaxRarity = static_cast<float>(EItemRarity::IR_GradeSS);
+
+		CachedGroundItemSubsystem->GetSpatialGrid().ForEachInRadius(CandidateOrigin, InteractionDistance,
+			[this, &Storage, MaxRarity](int32 ItemID, const FVector& Location)
+			{
+				const int32 DenseIndex = Storage.FindIndex(ItemID);
+				if (DenseIndex == INDEX_NONE)
+				{
+					return;
+				}
+
+				const float Priority = FMath::Min(static_cast<float>(Storage.Rarities[DenseIndex]) / MaxRarity, 1.0f);
+
+				float Score;
+				if (ScoreCandidate(Location, Priority, GroundItemConeAngle, true, Score))
+				{
+					FFocusCandidate& Candidate = FocusCandidates.AddDefaulted_GetRef();
+					Candidate.GroundItemID = ItemID;
+					Candidate.Location = Location;
+					Candidate.Score = Score;
+				}
+			});
+	}
+
+	FocusCandidates.Sort([](const FFocusCandidate& A, const FFocusCandidate& B)
+	{
+		return A.Score > B.Score;
+	});
+
+	if (FocusCandidates.Num() > MaxLOSChecks)
+	{
+		FocusCandidates.SetNum(MaxLOSChecks, EAllowShrinking::No);
+	}
+
+	return FocusCandidates.Num();
+}
+
+void FInteractionTraceManager::ResolveFocusCandidates(TScriptInterface<IInteractable>& OutInteractable, int32& OutGroundItemID)
+{
+	OutInteractable = nullptr;
+	OutGroundItemID = INDEX_NONE;
+
+	if (!WorldContext)
+	{
+		return;
+	}
+
+	// Best first - usually the first trace is the only one
+	for (const FFocusCandidate& Candidate : FocusCandidates)
+	{
+		const FVector Target = GetCandidateTraceTarget(Candidate);
+
+		FHitResult HitResult;
+		const bool bHit = WorldContext->LineTraceSingleByChannel(HitResult, CandidateOrigin, Target, InteractionTraceChannel, MakeCandidateQueryParams(Candidate));
+
+		if (DebugManager)
+		{
+			DebugManager->DrawTraceLine(CandidateOrigin, Target, bHit);
+		}
+
+		if (IsCandidateVisible(Candidate, bHit, HitResult))
+		{
+			SelectCandidate(Candidate, OutInteractable, OutGroundItemID);
+			return;
+		}
+	}
+}
+
+bool FInteractionTraceManager::RequestCandidateTraces()
+{
+	if (!WorldContext || FocusCandidates.Num() == 0)
+	{
+		return false;
+	}
+
+	AsyncTraceWaitTicks = 0;
+
+	for (FFocusCandidate& Candidate : FocusCandidates)
+	{
+		Candidate.TraceHandle = WorldContext->AsyncLineTraceByChannel(
+			EAsyncTraceType::Single,
+			CandidateOrigin,
+			GetCandidateTraceTarget(Candidate),
+			InteractionTraceChannel,
+			MakeCandidateQueryParams(Candidate)
+		);
+	}
+
+	return true;
+}
+
+bool FInteractionTraceManager::ConsumeCandidateTraces(TScriptInterface<IInteractable>& OutInteractable, int32& OutGroundItemID)
 {
 	if (!WorldContext)
 	{
 		return false;
 	}
 
-	// Setup trace params
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(OwnerActor);
-	QueryParams.bTraceComplex = false;
+	// All were issued together - wait until every one is back
+	TArray<FTraceDatum, TInlineAllocator<8>> Results;
+	Results.SetNum(FocusCandidates.Num());
+	for (int32 i = 0; i < FocusCandidates.Num(); ++i)
+	{
+		if (!WorldContext->QueryTraceData(FocusCandidates[i].TraceHandle, Results[i]))
+		{
+			if (AsyncTraceWaitTicks++ < MaxAsyncTraceWaitTicks)
+			{
+				return false;
+			}
+
+			// Results expired or stuck - trace the same candidates here rather than drop the scan
+			ResolveFocusCandidates(OutInteractable, OutGroundItemID);
+			FocusCandidates.Reset();
+			return true;
+		}
+	}
+
+	OutInteractable = nullptr;
+	OutGroundItemID = INDEX_NONE;
+
+	for (int32 i = 0; i < FocusCandidates.Num(); ++i)
+	{
+		const FFocusCandidate& Candidate = FocusCandidates[i];
+		const FTraceDatum& TraceData = Results[i];
+
+		const bool bHit = TraceData.OutHits.Num() > 0 && TraceData.OutHits[0].bBlockingHit;
+		const FHitResult HitResult = bHit ? TraceData.OutHits[0] : FHitResult();
+
+		if (DebugManager)
+		{
+			DebugManager->DrawTraceLine(TraceData.Start, TraceData.End, bHit);
+		}
+
+		if (IsCandidateVisible(Candidate, bHit, HitResult))
+		{
+			SelectCandidate(Candidate, OutInteractable, OutGroundItemID);
+			break;
+		}
+	}
+
+	FocusCandidates.Reset();
+	return true;
+}
+
+bool FInteractionTraceManager::ScoreCandidate(const FVector& Location, float Priority, float ConeAngle, bool bHorizontalCone, float& OutScore) const
+{
+	const FVector ToTarget = Location - CandidateOrigin;
+	const float Distance = ToTarget.Size();
+	if (Distance > InteractionDistance)
+	{
+		return false;
+	}
+
+	// Horizontal cone ignores pitch, so looking ahead still finds items at the feet
+	const FVector ConeDirection = bHorizontalCone ? FVector(ToTarget.X, ToTarget.Y, 0.0f) : ToTarget;
+	const FVector ConeForward = bHorizontalCone ? FVector(CandidateForward.X, CandidateForward.Y, 0.0f).GetSafeNormal() : CandidateForward;
+
+	// Standing on it (or looking straight down at it) counts as dead center
+	const float ConeDistance = ConeDirection.Size();
+	const float CosAngle = ConeDistance > UE_KINDA_SMALL_NUMBER && !ConeForward.IsNearlyZero()
+		? FVector::DotProduct(ConeDirection / ConeDistance, ConeForward)
+		: 1.0f;
+	const float CosCone = FMath::Cos(FMath::DegreesToRadians(ConeAngle));
+	if (CosAngle < CosCone)
+	{
+		return false;
+	}
+
+	const float AngleScore = (CosAngle - CosCone) / FMath::Max(1.0f - CosCone, UE_KINDA_SMALL_NUMBER);
+	const float DistanceScore = 1.0f - Distance / FMath::Max(InteractionDistance, 1.0f);
+
+	OutScore = AngleWeight * AngleScore + DistanceWeight * DistanceScore + PriorityWeight * Priority;
+	return true;
+}
+
+FVector FInteractionTraceManager::GetActorAimPoint(const AActor* Actor, const FVector& Fallback) const
+{
+	if (!Actor)
+	{
+		return Fallback;
+	}
+
+	FVector BoundsOrigin;
+	FVector BoundsExtent;
+	Actor->GetActorBounds(true, BoundsOrigin, BoundsExtent);
+	if (BoundsExtent.IsNearlyZero())
+	{
+		return Fallback;
+	}
+
+	// Where the view ray passes the bounds, pulled onto the box (the ray itself if it goes through)
+	const float AlongRay = FMath::Clamp(FVector::DotProduct(BoundsOrigin - CandidateOrigin, CandidateForward), 0.0f, InteractionDistance);
+	const FBox Bounds(BoundsOrigin - BoundsExtent, BoundsOrigin + BoundsExtent);
+	return Bounds.GetClosestPointTo(CandidateOrigin + CandidateForward * AlongRay);
+}
+
+FVector FInteractionTraceManager::GetCandidateTraceTarget(const FFocusCandidate& Candidate) const
+{
+	return Candidate.GroundItemID != INDEX_NONE
+		? Candidate.Location + FVector(0.0f, 0.0f, GroundItemLOSHeight)
+		: Candidate.Location;
+}
+
+FCollisionQueryParams FInteractionTraceManager::MakeCandidateQueryParams(const FFocusCandidate& Candidate) const
+{
+	FCollisionQueryParams QueryParams = MakeTraceQueryParams();
+
+	// Items never occlude each other (or themselves)
+	if (Candidate.GroundItemID != INDEX_NONE && CachedGroundItemSubsystem)
+	{
+		QueryParams.AddIgnoredActor(CachedGroundItemSubsystem->GetISMContainer());
+	}
+
+	return QueryParams;
+}
+
+bool FInteractionTraceManager::IsCandidateVisible(const FFocusCandidate& Candidate, bool bHit, const FHitResult& HitResult) const
+{
+	if (Candidate.GroundItemID != INDEX_NONE)
+	{
+		return !bHit && CachedGroundItemSubsystem && CachedGroundItemSubsystem->GetItemLocation(Candidate.GroundItemID);
+	}
+
+	const UInteractableManager* Interactable = Candidate.Interactable.Get();
+	if (!Interactable)
+	{
+		return false;
+	}
+
+	// Reaching the origin, or hitting the actor's own collision first, both count
+	return !bHit || HitResult.GetActor() == Interactable->GetOwner();
+}
+
+void FInteractionTraceManager::SelectCandidate(const FFocusCandidate& Candidate, TScriptInterface<IInteractable>& OutInteractable, int32& OutGroundItemID) const
+{
+	if (Candidate.GroundItemID != INDEX_NONE)
+	{
+		OutGroundItemID = Candidate.GroundItemID;
+		return;
+	}
+
+	if (UInteractableManager* Interactable = Candidate.Interactable.Get())
+	{
+		OutInteractable.SetObject(Interactable);
+		OutInteractable.SetInterface(Cast<IInteractable>(Interactable));
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// SCHEDULING
+// ═══════════════════════════════════════════════════════════════════════
+
+bool FInteractionTraceManager::ShouldScan()
+{
+	NextScanDelay = CheckFrequency;
+
+	if (!bAdaptiveScan)
+	{
+		return true;
+	}
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	if (!WorldContext || !GetCameraViewPoint(ViewLocation, ViewRotation))
+	{
+		return false;
+	}
+
+	const float Now = WorldContext->GetTimeSeconds();
+	const FQuat ViewQuat = ViewRotation.Quaternion();
+
+	if (!bScanRequested)
+	{
+		const float Elapsed = Now - LastScanTime;
+		const float Moved = FVector::Dist(ViewLocation, LastScanLocation);
+		const float Turned = FMath::RadiansToDegrees(ViewQuat.AngularDistance(LastScanRotation));
+
+		if (Moved <= ScanMoveThreshold && Turned <= ScanRotationThreshold)
+		{
+			// OPTIMIZATION: Still view - back off towards IdleScanInterval (the timer sleeps too)
+			if (Elapsed < CurrentIdleInterval)
+			{
+				NextScanDelay = FMath::Max(CurrentIdleInterval - Elapsed, FastScanInterval);
+				return false;
+			}
+			CurrentIdleInterval = FMath::Min(CurrentIdleInterval * 2.0f, IdleScanInterval);
+			NextScanDelay = FMath::Max(CurrentIdleInterval, FastScanInterval);
+		}
+		else
+		{
+			const float TurnRate = Elapsed > UE_KINDA_SMALL_NUMBER ? Turned / Elapsed : 0.0f;
+			const float Interval = TurnRate >= FastRotationSpeed ? FastScanInterval : CheckFrequency;
+			NextScanDelay = FMath::Max(Interval, FastScanInterval);
+			if (Elapsed < Interval)
+			{
+				NextScanDelay = FMath::Max(Interval - Elapsed, FastScanInterval);
+				return false;
+			}
+			CurrentIdleInterval = CheckFrequency;
+		}
+	}
+
+	bScanRequested = false;
+	LastScanTime = Now;
+	LastScanLocation = ViewLocation;
+	LastScanRotation = ViewQuat;
+	return true;
+}
+
+bool FInteractionTraceManager::RequestScan()
+{
+	const bool bWasRequested = bScanRequested;
+	bScanRequested = true;
+
+	// Batched ground proximity may lag one pass - keep the follow-up scan close
+	CurrentIdleInterval = CheckFrequency;
+
+	return !bWasRequested;
+}
+
+bool FInteractionTraceManager::IsNearLastScan(const FVector& Location) const
+{
+	const float Range = InteractionDistance + RegistryQueryMargin;
+	return FVector::DistSquared(Location, LastScanLocation) <= FMath::Square(Range);
+}
+
+bool FInteractionTraceManager::PerformLineTrace(const FVector& Start, const FVector& End, FHitResult& OutHit)
+{
+	if (!WorldContext)
+	{
+		return false;
+	}
 
 	// Perform line trace
 	return WorldContext->LineTraceSingleByChannel(
@@ -281,23 +747,91 @@ bool FInteractionTraceManager::PerformLineTrace(const FVector& Start, const FVec
 		Start,
 		End,
 		InteractionTraceChannel,
-		QueryParams
+		MakeTraceQueryParams()
 	);
 }
 
-bool FInteractionTraceManager::IsActorInteractable(AActor* Actor) const
+FCollisionQueryParams FInteractionTraceManager::MakeTraceQueryParams() const
 {
-	if (!Actor)
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(InteractionFocusTrace), false, OwnerActor);
+	return QueryParams;
+}
+
+bool FInteractionTraceManager::GetFocusTraceSegment(FVector& OutStart, FVector& OutEnd) const
+{
+	FVector CameraLocation;
+	FRotator CameraRotation;
+	if (!GetCameraViewPoint(CameraLocation, CameraRotation))
 	{
 		return false;
 	}
 
-	// Check for InteractableManager component
-	if (Actor->FindComponentByClass<UInteractableManager>())
+	OutStart = GetTraceStartLocation(CameraLocation, CameraRotation);
+	OutEnd = GetTraceEndLocation(CameraLocation, CameraRotation);
+
+	// OPTIMIZATION: Nothing registered in range - no trace at all
+	if (bSkipTraceWhenNoneNearby && CachedInteractableRegistry
+		&& !CachedInteractableRegistry->HasInteractableInRadius(OutStart, InteractionDistance + RegistryQueryMargin))
 	{
-		return true;
+		return false;
+	}
+
+	return true;
+}
+
+TScriptInterface<IInteractable> FInteractionTraceManager::ResolveTraceHit(bool bHit, const FHitResult& HitResult, const FVector& Start, const FVector& End)
+{
+	// ═══════════════════════════════════════════════════════════════
+	// DEBUG VISUALIZATION - Draw as soon as the result is known
+	// ═══════════════════════════════════════════════════════════════
+	if (DebugManager)
+	{
+		DebugManager->DrawTraceLine(Start, End, bHit);
+
+		if (bHit)
+		{
+			DebugManager->DrawHitPoint(HitResult.Location, HitResult.Normal);
+		}
 	}
 
-	// Check if actor implements interface
-	return Actor->GetClass()->ImplementsInterface(UInteractable::StaticClass());
+	if (!bHit)
+	{
+		return TScriptInterface<IInteractable>();
+	}
+
+	// Component first, then actor interface (one registry lookup)
+	TScriptInterface<IInteractable> Result = ResolveInteractable(HitResult.GetActor());
+	if (Result.GetInterface())
+	{
+		LastTraceResult = HitResult;
+	}
+
+	return Result;
+}
+
+TScriptInterface<IInteractable> FInteractionTraceManager::ResolveInteractable(AActor* Actor) const
+{
+	if (CachedInteractableRegistry)
+	{
+		return CachedInteractableRegistry->ResolveInteractable(Actor);
+	}
+
+	TScriptInterface<IInteractable> Result;
+	if (!Actor)
+	{
+		return Result;
+	}
+
+	if (UInteractableManager* InteractableComp = Actor->FindComponentByClass<UInteractableManager>())
+	{
+		Result.SetObject(InteractableComp);
+		Result.SetInterface(Cast<IInteractable>(InteractableComp));
+	}
+	else if (Actor->GetClass()->ImplementsInterface(UInteractable::StaticClass()))
+	{
+		Result.SetObject(Actor);
+		Result.SetInterface(Cast<IInteractable>(Actor));
+	}
+
+	return Result;
 }
\ No newline at end of file
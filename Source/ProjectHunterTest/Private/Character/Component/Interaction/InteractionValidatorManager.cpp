@@ -3,7 +3,9 @@
 #include "Character/Component/Interaction/InteractionValidatorManager.h"
 #include "Interactable/Interface/Interactable.h"
 #include "Interactable/Component/InteractableManager.h"
+#include "Interactable/Subsystem/InteractableRegistrySubsystem.h"
 #include "Tower/Subsystem/GroundItemSubsystem.h"
+#include "Tower/Actors/ISMContainerActor.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/PlayerState.h"
 #include "GameFramework/Pawn.h"
@@ -21,8 +23,12 @@ FInteractionValidatorManager::FInteractionValidatorManager()
 	, OwnerActor(nullptr)
 	, WorldContext(nullptr)
 	, CachedGroundItemSubsystem(nullptr)
+	, CachedInteractableRegistry(nullptr)
 	, ValidationFailureCount(0)
 	, LastValidationFailureTime(0.0f)
+	, ValidationTokens(0.0f)
+	, LastTokenRefillTime(0.0f)
+	, bRateLimited(false)
 {
 }
 
@@ -38,6 +44,10 @@ void FInteractionValidatorManager::Initialize(AActor* Owner, UWorld* World)
 	}
 
 	CacheComponents();
+
+	// Start with a full bucket
+	ValidationTokens = ValidationBurst;
+	LastTokenRefillTime = WorldContext->GetTimeSeconds();
 	
 	UE_LOG(LogInteractionValidatorManager, Log, TEXT("InteractionValidatorManager: Initialized for %s"), *OwnerActor->GetName());
 }
@@ -48,8 +58,15 @@ void FInteractionValidatorManager::Initialize(AActor* Owner, UWorld* World)
 
 bool FInteractionValidatorManager::ValidateActorInteraction(AActor* TargetActor, FVector ClientLocation, float MaxDistance)
 {
+	// OPTIMIZATION: Throttled requests never reach a trace
+	if (!ConsumeValidationToken())
+	{
+		return false;
+	}
+
 	if (!TargetActor)
 	{
+		Stats.RejectedState++;
 		if (bLogValidationFailures)
 		{
 			UE_LOG(LogInteractionValidatorManager, Warning, TEXT("Validation Failed: Null target actor"));
@@ -61,6 +78,7 @@ bool FInteractionValidatorManager::ValidateActorInteraction(AActor* TargetActor,
 	FVector TargetLocation = TargetActor->GetActorLocation();
 	if (!ValidateDistance(ClientLocation, TargetLocation, MaxDistance, true))
 	{
+		Stats.RejectedDistance++;
 		LogValidationFailure("Distance check failed", ClientLocation, TargetLocation);
 		return false;
 	}
@@ -71,6 +89,7 @@ bool FInteractionValidatorManager::ValidateActorInteraction(AActor* TargetActor,
 		// Pass both source and target actors for proper line of sight validation
 		if (!HasLineOfSight(ClientLocation, TargetLocation, OwnerActor, TargetActor))
 		{
+			Stats.RejectedLineOfSight++;
 			LogValidationFailure("Line of sight check failed", ClientLocation, TargetLocation);
 			return false;
 		}
@@ -79,6 +98,7 @@ bool FInteractionValidatorManager::ValidateActorInteraction(AActor* TargetActor,
 	// Validate interactable state
 	if (!IsValidInteractable(TargetActor, OwnerActor))
 	{
+		Stats.RejectedState++;
 		if (bLogValidationFailures)
 		{
 			UE_LOG(LogInteractionValidatorManager, Warning, TEXT("Validation Failed: Target not interactable - %s"), *TargetActor->GetName());
@@ -86,6 +106,7 @@ bool FInteractionValidatorManager::ValidateActorInteraction(AActor* TargetActor,
 		return false;
 	}
 
+	Stats.Accepted++;
 	return true;
 }
 
@@ -96,10 +117,16 @@ bool FInteractionValidatorManager::ValidateGroundItemPickup(int32 ItemID, FVecto
 		return false;
 	}
 
+	if (!ConsumeValidationToken())
+	{
+		return false;
+	}
+
 	// Get item location from subsystem
-	const FVector* ItemLocation = CachedGroundItemSubsystem->GetInstanceLocations().Find(ItemID);
+	const FVector* ItemLocation = CachedGroundItemSubsystem->GetItemLocation(ItemID);
 	if (!ItemLocation)
 	{
+		Stats.RejectedState++;
 		if (bLogValidationFailures)
 		{
 			UE_LOG(LogInteractionValidatorManager, Warning, TEXT("Validation Failed: Ground item %d not found"), ItemID);
@@ -110,13 +137,147 @@ bool FInteractionValidatorManager::ValidateGroundItemPickup(int32 ItemID, FVecto
 	// Validate distance
 	if (!ValidateDistance(ClientLocation, *ItemLocation, MaxDistance, true))
 	{
+		Stats.RejectedDistance++;
 		LogValidationFailure("Ground item distance check failed", ClientLocation, *ItemLocation);
 		return false;
 	}
 
+	Stats.Accepted++;
 	return true;
 }
 
+int32 FInteractionValidatorManager::ValidateGroundItemBatch(const TArray<int32>& ItemIDs, FVector ClientLocation, float MaxDistance, TArray<int32>& OutValidIDs)
+{
+	OutValidIDs.Reset();
+
+	if (!CachedGroundItemSubsystem || ItemIDs.Num() == 0)
+	{
+		return 0;
+	}
+
+	// One token per request, not per item
+	if (!ConsumeValidationToken())
+	{
+		return 0;
+	}
+
+	struct FPickupCluster
+	{
+		FVector LocationSum = FVector::ZeroVector;
+		TArray<int32, TInlineAllocator<16>> ItemIDs;
+	};
+
+	TMap<FIntPoint, FPickupCluster> Clusters;
+	TSet<int32> SeenIDs;
+	SeenIDs.Reserve(ItemIDs.Num());
+
+	for (int32 ItemID : ItemIDs)
+	{
+		bool bAlreadySeen = false;
+		SeenIDs.Add(ItemID, &bAlreadySeen);
+		if (bAlreadySeen)
+		{
+			continue;
+		}
+
+		// Already gone (someone else got it) - not suspicious, just stale
+		const FVector* ItemLocation = CachedGroundItemSubsystem->GetItemLocation(ItemID);
+		if (!ItemLocation)
+		{
+			Stats.RejectedState++;
+			continue;
+		}
+
+		// Cheap math - per item
+		if (!ValidateDistance(ClientLocation, *ItemLocation, MaxDistance, true))
+		{
+			Stats.RejectedDistance++;
+			LogValidationFailure("Batch pickup distance check failed", ClientLocation, *ItemLocation);
+			continue;
+		}
+
+		const FIntPoint Cell(
+			FMath::FloorToInt(ItemLocation->X / PickupClusterSize),
+			FMath::FloorToInt(ItemLocation->Y / PickupClusterSize));
+
+		FPickupCluster& Cluster = Clusters.FindOrAdd(Cell);
+		Cluster.LocationSum += *ItemLocation;
+		Cluster.ItemIDs.Add(ItemID);
+	}
+
+	// OPTIMIZATION: Traces - one per cluster, not per item
+	AActor* GroundItemsActor = CachedGroundItemSubsystem->GetISMContainer();
+
+	for (const TPair<FIntPoint, FPickupCluster>& Pair : Clusters)
+	{
+		const FPickupCluster& Cluster = Pair.Value;
+
+		if (bRequireLineOfSight)
+		{
+			// Raised off the floor the items rest on, same as the focus trace
+			const FVector LOSTarget = Cluster.LocationSum / Cluster.ItemIDs.Num() + FVector(0.0f, 0.0f, GroundItemLOSHeight);
+
+			// Hitting any ground item counts as reaching the cluster
+			if (!HasLineOfSight(ClientLocation, LOSTarget, OwnerActor, GroundItemsActor))
+			{
+				Stats.RejectedLineOfSight += Cluster.ItemIDs.Num();
+				LogValidationFailure("Batch pickup line of sight check failed", ClientLocation, LOSTarget);
+				continue;
+			}
+		}
+
+		OutValidIDs.Append(Cluster.ItemIDs);
+	}
+
+	Stats.Accepted += OutValidIDs.Num();
+	return OutValidIDs.Num();
+}
+
+bool FInteractionValidatorManager::ConsumeValidationToken()
+{
+	// Listen-server host / standalone: nothing crossed the network, nothing to bound
+	if (!bRateLimitValidation || !WorldContext || !IsRemoteRequester())
+	{
+		return true;
+	}
+
+	// Refill for the time since the last request
+	const float Now = WorldContext->GetTimeSeconds();
+	ValidationTokens = FMath::Min(ValidationTokens + (Now - LastTokenRefillTime) * ValidationRefillRate, ValidationBurst);
+	LastTokenRefillTime = Now;
+
+	if (ValidationTokens >= 1.0f)
+	{
+		ValidationTokens -= 1.0f;
+		bRateLimited = false;
+		return true;
+	}
+
+	Stats.RejectedRateLimit++;
+
+	// Log once per throttled burst - a spamming client must not flood the log either
+	if (!bRateLimited && bLogValidationFailures)
+	{
+		UE_LOG(LogInteractionValidatorManager, Warning, TEXT("VALIDATION THROTTLED on %s: over %.1f requests/s (rate-limited total=%d)"),
+			OwnerActor ? *OwnerActor->GetName() : TEXT("NULL"),
+			ValidationRefillRate,
+			Stats.RejectedRateLimit
+		);
+	}
+
+	bRateLimited = true;
+	return false;
+}
+
+bool FInteractionValidatorManager::IsRemoteRequester() const
+{
+	const APawn* OwnerPawn = Cast<APawn>(OwnerActor);
+	const AController* Controller = OwnerPawn ? OwnerPawn->GetController() : nullptr;
+
+	// Unpossessed pawns can't send RPCs; AI and local players are already on this machine
+	return Controller && !Controller->IsLocalController();
+}
+
 bool FInteractionValidatorManager::IsValidInteractable(AActor* Actor, AActor* Interactor) const
 {
 	if (!Actor)
@@ -124,8 +285,10 @@ bool FInteractionValidatorManager::IsValidInteractable(AActor* Actor, AActor* In
 		return false;
 	}
 
-	// Check component
-	UInteractableManager* InteractableComp = Actor->FindComponentByClass<UInteractableManager>();
+	// Check component (registry lookup, component search only without a registry)
+	UInteractableManager* InteractableComp = CachedInteractableRegistry
+		? CachedInteractableRegistry->FindInteractable(Actor)
+		: Actor->FindComponentByClass<UInteractableManager>();
 	if (InteractableComp)
 	{
 		return IInteractable::Execute_CanInteract(InteractableComp, Interactor);
@@ -168,6 +331,16 @@ bool FInteractionValidatorManager::HasLineOfSight(FVector Start, FVector End, AA
 		return false;
 	}
 
+	// OPTIMIZATION: Same viewer and target, nothing moved, answered recently - no trace
+	const float Now = WorldContext->GetTimeSeconds();
+	if (const FLOSCacheEntry* Cached = FindCachedLineOfSight(SourceActor, TargetActor, Start, End, Now))
+	{
+		Stats.LOSCacheHits++;
+		return Cached->bClear;
+	}
+
+	Stats.LOSTraces++;
+
 	// Setup trace params
 	FCollisionQueryParams QueryParams;
 	
@@ -190,20 +363,78 @@ bool FInteractionValidatorManager::HasLineOfSight(FVector Start, FVector End, AA
 	);
 
 	// No hit means clear line of sight
-	if (!bHit)
+	// If we hit something, check if it's the target actor we're trying to interact with
+	// Hitting the target actor itself (or its components) counts as valid line of sight
+	// Anything else is blocking line of sight
+	const bool bClear = !bHit || (TargetActor && HitResult.GetActor() == TargetActor);
+
+	StoreLineOfSight(SourceActor, TargetActor, Start, End, Now, bClear);
+	return bClear;
+}
+
+const FInteractionValidatorManager::FLOSCacheEntry* FInteractionValidatorManager::FindCachedLineOfSight(const AActor* SourceActor, const AActor* TargetActor, const FVector& Start, const FVector& End, float Now) const
+{
+	if (!TargetActor || LOSCacheLifetime <= 0.0f)
 	{
-		return true;
+		return nullptr;
 	}
 
-	// If we hit something, check if it's the target actor we're trying to interact with
-	// Hitting the target actor itself (or its components) counts as valid line of sight
-	if (TargetActor && HitResult.GetActor() == TargetActor)
+	const FLOSCacheEntry* Entry = LOSCache.Find({ SourceActor, TargetActor });
+	if (!Entry || Now - Entry->Time > LOSCacheLifetime)
 	{
-		return true;
+		return nullptr;
 	}
 
-	// Hit something else that's blocking line of sight
-	return false;
+	const float ToleranceSq = FMath::Square(LOSCacheMoveTolerance);
+	if (FVector::DistSquared(Entry->Start, Start) > ToleranceSq || FVector::DistSquared(Entry->End, End) > ToleranceSq)
+	{
+		return nullptr;
+	}
+
+	return Entry;
+}
+
+void FInteractionValidatorManager::StoreLineOfSight(const AActor* SourceActor, const AActor* TargetActor, const FVector& Start, const FVector& End, float Now, bool bClear)
+{
+	if (!TargetActor || LOSCacheLifetime <= 0.0f)
+	{
+		return;
+	}
+
+	const FLOSCacheKey Key{ SourceActor, TargetActor };
+
+	// Bounded - expired entries go first, then the oldest
+	if (LOSCache.Num() >= MaxLOSCacheEntries && !LOSCache.Contains(Key))
+	{
+		for (auto It = LOSCache.CreateIterator(); It; ++It)
+		{
+			if (Now - It.Value().Time > LOSCacheLifetime)
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		if (LOSCache.Num() >= MaxLOSCacheEntries)
+		{
+			FLOSCacheKey OldestKey;
+			float OldestTime = TNumericLimits<float>::Max();
+			for (const TPair<FLOSCacheKey, FLOSCacheEntry>& Pair : LOSCache)
+			{
+				if (Pair.Value.Time < OldestTime)
+				{
+					OldestTime = Pair.Value.Time;
+					OldestKey = Pair.Key;
+				}
+			}
+			LOSCache.Remove(OldestKey);
+		}
+	}
+
+	FLOSCacheEntry& Entry = LOSCache.FindOrAdd(Key);
+	Entry.Start = Start;
+	Entry.End = End;
+	Entry.Time = Now;
+	Entry.bClear = bClear;
 }
 
 // ═══════════════════════════════════════════════════════════════════════
@@ -281,9 +512,10 @@ void FInteractionValidatorManager::LogValidationFailure(const FString& Reason, F
 
 void FInteractionValidatorManager::CacheComponents()
 {
-	// Cache ground item subsystem
+	// Cache ground item subsystem + interactable registry
 	if (WorldContext)
 	{
+		CachedInteractableRegistry = WorldContext->GetSubsystem<UInteractableRegistrySubsystem>();
 		CachedGroundItemSubsystem = WorldContext->GetSubsystem<UGroundItemSubsystem>();
 		if (!CachedGroundItemSubsystem)
 		{
@@ -108,6 +108,37 @@ bool UInventoryManager::AddItemToSlot(UItemInstance* Item, int32 SlotIndex)
 	return true;
 }
 
+int32 UInventoryManager::AddItems(const TArray<UItemInstance*>& InItems, TArray<UItemInstance*>& OutRejected)
+{
+	// OPTIMIZATION: One OnInventoryChanged / OnWeightChanged for the whole batch
+	bDeferChangeBroadcasts = true;
+	bChangeBroadcastPending = false;
+
+	int32 AddedCount = 0;
+	for (UItemInstance* Item : InItems)
+	{
+		if (AddItem(Item))
+		{
+			AddedCount++;
+		}
+		else
+		{
+			OutRejected.Add(Item);
+		}
+	}
+
+	bDeferChangeBroadcasts = false;
+
+	if (bChangeBroadcastPending)
+	{
+		bChangeBroadcastPending = false;
+		BroadcastInventoryChanged();
+		UpdateWeight();
+	}
+
+	return AddedCount;
+}
+
 bool UInventoryManager::RemoveItem(UItemInstance* Item)
 {
 	if (!Item)
@@ -682,12 +713,24 @@ bool UInventoryManager::WouldExceedWeight(UItemInstance* Item) const
 
 void UInventoryManager::UpdateWeight()
 {
+	if (bDeferChangeBroadcasts)
+	{
+		bChangeBroadcastPending = true;
+		return;
+	}
+
 	float CurrentWeight = GetTotalWeight();
 	OnWeightChanged.Broadcast(CurrentWeight, MaxWeight);
 }
 
 void UInventoryManager::BroadcastInventoryChanged()
 {
+	if (bDeferChangeBroadcasts)
+	{
+		bChangeBroadcastPending = true;
+		return;
+	}
+
 	OnInventoryChanged.Broadcast();
 }
 
@@ -0,0 +1,266 @@
+// Character/HUD/GroundItemLabelRenderer.cpp
+
+#include "Character/HUD/GroundItemLabelRenderer.h"
+#include "Tower/Subsystem/GroundItemSubsystem.h"
+#include "Engine/Canvas.h"
+#include "Engine/Font.h"
+#include "CanvasItem.h"
+
+FGroundItemLabelRenderer::FGroundItemLabelRenderer()
+	: WorldContext(nullptr)
+{
+}
+
+void FGroundItemLabelRenderer::Initialize(UWorld* World)
+{
+	WorldContext = World;
+	Reset();
+}
+
+void FGroundItemLabelRenderer::Reset()
+{
+	Candidates.Reset();
+	Labels.Reset();
+	TextCache.Empty();
+	NextTextCache.Empty();
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// UPDATE
+// ═══════════════════════════════════════════════════════════════════════
+
+void FGroundItemLabelRenderer::Update(UCanvas* Canvas, UFont* Font, const FVector& ViewLocation, const FGroundItemLabelSettings& Settings)
+{
+	Labels.Reset();
+
+	UGroundItemSubsystem* Subsystem = WorldContext ? WorldContext->GetSubsystem<UGroundItemSubsystem>() : nullptr;
+	if (!Subsystem || !Canvas || !Font || Settings.MaxLabels <= 0)
+	{
+		return;
+	}
+
+	GatherCandidates(Subsystem, Canvas, ViewLocation, Settings);
+
+	// Rarest first, nearest first within a rarity
+	Candidates.Sort([](const FCandidate& A, const FCandidate& B)
+	{
+		if (A.Rarity != B.Rarity)
+		{
+			return A.Rarity > B.Rarity;
+		}
+		return A.DistanceSq < B.DistanceSq;
+	});
+
+	NextTextCache.Reset();
+
+	for (const FCandidate& Candidate : Candidates)
+	{
+		if (Labels.Num() >= Settings.MaxLabels)
+		{
+			break;
+		}
+
+		FCachedText PileText;
+		const FCachedText* Text = nullptr;
+		if (Candidate.ItemID == INDEX_NONE)
+		{
+			// Few piles - not worth caching
+			PileText.Text = FText::Format(NSLOCTEXT("GroundItemLabels", "PileLabel", "{0} items"), Candidate.PileCount);
+			Canvas->TextSize(Font, PileText.Text.ToString(), PileText.Size.X, PileText.Size.Y, Settings.TextScale, Settings.TextScale);
+			Text = &PileText;
+		}
+		else
+		{
+			Text = &GetItemText(Subsystem, Candidate.ItemID, Candidate.Rarity, Canvas, Font, Settings.TextScale);
+		}
+
+		const FVector2D BoxSize = Text->Size + FVector2D(Settings.Padding * 2.0f);
+		FVector2D Min(Candidate.ScreenPosition.X - BoxSize.X * 0.5f, Candidate.ScreenPosition.Y - BoxSize.Y);
+		FBox2D Bounds(Min, Min + BoxSize);
+
+		// Nudge up until it fits; lower-priority labels give way
+		bool bPlaced = !OverlapsPlaced(Bounds);
+		for (int32 Nudge = 0; !bPlaced && Nudge < Settings.MaxNudges; ++Nudge)
+		{
+			Bounds = Bounds.ShiftBy(FVector2D(0.0f, -(BoxSize.Y + Settings.Padding)));
+			bPlaced = !OverlapsPlaced(Bounds);
+		}
+
+		if (!bPlaced)
+		{
+			continue;
+		}
+
+		FLabel& Label = Labels.AddDefaulted_GetRef();
+		Label.ItemID = Candidate.ItemID;
+		Label.Bounds = Bounds;
+		Label.Text = Text->Text;
+		Label.Color = GetItemRarityColor(Candidate.Rarity);
+
+		if (Candidate.ItemID != INDEX_NONE)
+		{
+			NextTextCache.Add(Candidate.ItemID, *Text);
+		}
+	}
+
+	// Keep only what was drawn - the cache never grows past MaxLabels
+	Swap(TextCache, NextTextCache);
+}
+
+void FGroundItemLabelRenderer::GatherCandidates(UGroundItemSubsystem* Subsystem, UCanvas* Canvas, const FVector& ViewLocation, const FGroundItemLabelSettings& Settings)
+{
+	Candidates.Reset();
+
+	const FGroundItemStorage& Storage = Subsystem->GetStorage();
+
+	Subsystem->GetSpatialGrid().ForEachInRadius(ViewLocation, Settings.MaxDistance,
+		[&](int32 ItemID, const FVector& Location)
+		{
+			const int32 DenseIndex = Storage.FindIndex(ItemID);
+			if (DenseIndex == INDEX_NONE)
+			{
+				return;
+			}
+
+			const EItemRarity Rarity = Storage.Rarities[DenseIndex];
+			if (Rarity < Settings.MinRarity)
+			{
+				return;
+			}
+
+			// Collapsed into a pile - the pile gets the label
+			if (Settings.bLabelPiles && Subsystem->IsLocationCollapsed(Location))
+			{
+				return;
+			}
+
+			FCandidate Candidate;
+			Candidate.ItemID = ItemID;
+			Candidate.Location = Location;
+			Candidate.DistanceSq = FVector::DistSquared(ViewLocation, Location);
+			Candidate.Rarity = Rarity;
+			AddCandidate(MoveTemp(Candidate), Canvas, Settings);
+		});
+
+	if (!Settings.bLabelPiles)
+	{
+		return;
+	}
+
+	const float MaxDistanceSq = FMath::Square(Settings.MaxDistance);
+	for (const FGroundItemPile& Pile : Subsystem->GetPiles())
+	{
+		const float DistanceSq = FVector::DistSquared(ViewLocation, Pile.Location);
+		if (DistanceSq > MaxDistanceSq || Pile.HighestRarity < Settings.MinRarity)
+		{
+			continue;
+		}
+
+		FCandidate Candidate;
+		Candidate.PileCount = Pile.Count;
+		Candidate.Location = Pile.Location;
+		Candidate.DistanceSq = DistanceSq;
+		Candidate.Rarity = Pile.HighestRarity;
+		AddCandidate(MoveTemp(Candidate), Canvas, Settings);
+	}
+}
+
+void FGroundItemLabelRenderer::AddCandidate(FCandidate&& Candidate, UCanvas* Canvas, const FGroundItemLabelSettings& Settings)
+{
+	const FVector Projected = Canvas->Project(Candidate.Location + FVector(0.0f, 0.0f, Settings.HeightOffset));
+
+	// Z is zero behind the camera
+	if (Projected.Z <= 0.0f
+		|| Projected.X < 0.0f || Projected.X > Canvas->ClipX
+		|| Projected.Y < 0.0f || Projected.Y > Canvas->ClipY)
+	{
+		return;
+	}
+
+	Candidate.ScreenPosition = FVector2D(Projected.X, Projected.Y);
+	Candidates.Add(MoveTemp(Candidate));
+}
+
+const FGroundItemLabelRenderer::FCachedText& FGroundItemLabelRenderer::GetItemText(UGroundItemSubsystem* Subsystem, int32 ItemID, EItemRarity Rarity, UCanvas* Canvas, UFont* Font, float Scale)
+{
+	// Clients get the replicated base name; grade name only if even that is missing
+	FText Name;
+	int32 Quantity = 1;
+	if (!Subsystem->GetItemDisplayInfo(ItemID, Name, Quantity))
+	{
+		Name = UEnum::GetDisplayValueAsText(Rarity);
+	}
+
+	// Same source -> same text; only a changed item pays for Format + TextSize
+	FCachedText* Cached = TextCache.Find(ItemID);
+	if (Cached && Cached->SourceQuantity == Quantity && Cached->SourceName.IdenticalTo(Name, ETextIdenticalModeFlags::DeepCompare | ETextIdenticalModeFlags::LexicalCompareInvariants))
+	{
+		return *Cached;
+	}
+
+	FCachedText& Entry = Cached ? *Cached : TextCache.Add(ItemID);
+	Entry.SourceName = Name;
+	Entry.SourceQuantity = Quantity;
+	Entry.Text = Quantity > 1
+		? FText::Format(NSLOCTEXT("GroundItemLabels", "StackLabel", "{0} x{1}"), Name, Quantity)
+		: Name;
+
+	Canvas->TextSize(Font, Entry.Text.ToString(), Entry.Size.X, Entry.Size.Y, Scale, Scale);
+	return Entry;
+}
+
+bool FGroundItemLabelRenderer::OverlapsPlaced(const FBox2D& Bounds) const
+{
+	// Linear scan is fine - bounded by MaxLabels
+	for (const FLabel& Label : Labels)
+	{
+		if (Label.Bounds.Intersect(Bounds))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// DRAW
+// ═══════════════════════════════════════════════════════════════════════
+
+void FGroundItemLabelRenderer::Draw(UCanvas* Canvas, UFont* Font, const FGroundItemLabelSettings& Settings) const
+{
+	if (!Canvas || !Font || Labels.Num() == 0)
+	{
+		return;
+	}
+
+	FCanvasTileItem Background(FVector2D::ZeroVector, FVector2D::ZeroVector, Settings.BackgroundColor);
+	Background.BlendMode = SE_BLEND_Translucent;
+
+	FCanvasTextItem TextItem(FVector2D::ZeroVector, FText::GetEmpty(), Font, FLinearColor::White);
+	TextItem.Scale = FVector2D(Settings.TextScale);
+	TextItem.EnableShadow(FLinearColor::Black);
+
+	for (const FLabel& Label : Labels)
+	{
+		Background.Position = Label.Bounds.Min;
+		Background.Size = Label.Bounds.GetSize();
+		Canvas->DrawItem(Background);
+
+		TextItem.Position = Label.Bounds.Min + FVector2D(Settings.Padding);
+		TextItem.Text = Label.Text;
+		TextItem.SetColor(Label.Color);
+		Canvas->DrawItem(TextItem);
+	}
+}
+
+int32 FGroundItemLabelRenderer::FindItemAtScreenPosition(const FVector2D& ScreenPosition) const
+{
+	for (const FLabel& Label : Labels)
+	{
+		if (Label.ItemID != INDEX_NONE && Label.Bounds.IsInside(ScreenPosition))
+		{
+			return Label.ItemID;
+		}
+	}
+	return INDEX_NONE;
+}
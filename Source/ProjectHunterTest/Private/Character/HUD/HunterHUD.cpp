@@ -4,6 +4,8 @@
 #include "Character/HUD/HunterHUD.h"
 
 #include "Interactable/Widget/ItemTooltipWidget.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
 
 void AHunterHUD::BeginPlay()
 {
@@ -16,6 +18,36 @@ void AHunterHUD::BeginPlay()
 		ItemTooltipWidget->AddToViewport(100);  // High Z-order
 		ItemTooltipWidget->SetVisibility(ESlateVisibility::Hidden);
 	}
+
+	GroundItemLabels.Initialize(GetWorld());
+}
+
+void AHunterHUD::DrawHUD()
+{
+	Super::DrawHUD();
+
+	if (!bShowGroundItemLabels || !Canvas || !PlayerOwner)
+	{
+		return;
+	}
+
+	UFont* Font = GroundItemLabelFont ? GroundItemLabelFont : GEngine->GetSmallFont();
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	PlayerOwner->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+	GroundItemLabels.Update(Canvas, Font, ViewLocation, GroundItemLabelSettings);
+	GroundItemLabels.Draw(Canvas, Font, GroundItemLabelSettings);
+}
+
+void AHunterHUD::SetGroundItemLabelsVisible(bool bVisible)
+{
+	bShowGroundItemLabels = bVisible;
+	if (!bVisible)
+	{
+		GroundItemLabels.Reset();
+	}
 }
 
 void AHunterHUD::ShowItemTooltip(UItemInstance* Item, FVector2D ScreenPosition)
@@ -8,6 +8,7 @@
 #include "GameplayEffect.h"
 #include "GameplayEffectTypes.h"
 #include "Character/Component/EquipmentManager.h"
+#include "Character/Component/ConsumableCooldownManager.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Net/UnrealNetwork.h"
@@ -34,6 +35,9 @@ AHunterBaseCharacter::AHunterBaseCharacter(const FObjectInitializer& ObjectIniti
 
 	// Create Stats Manager
 	StatsManager = CreateDefaultSubobject<UStatsManager>(TEXT("StatsManager"));
+
+	// Create Consumable Cooldown Manager
+	ConsumableCooldownManager = CreateDefaultSubobject<UConsumableCooldownManager>(TEXT("ConsumableCooldownManager"));
 }
 
 void AHunterBaseCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
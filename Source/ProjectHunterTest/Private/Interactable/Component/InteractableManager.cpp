@@ -2,6 +2,8 @@
 
 #include "Interactable/Component/InteractableManager.h"
 #include "Interactable/Widget/InteractableWidget.h"
+#include "Interactable/Subsystem/InteractableRegistrySubsystem.h"
+#include "Interactable/Subsystem/InteractableBillboardSubsystem.h"
 #include "Components/PrimitiveComponent.h"
 #include "Components/WidgetComponent.h"
 #include "GameFramework/Actor.h"
@@ -30,12 +32,30 @@ void UInteractableManager::BeginPlay()
 	{
 		CreateWidgetComponent();
 	}
+
+	// Make this actor findable without FindComponentByClass
+	if (UInteractableRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UInteractableRegistrySubsystem>())
+	{
+		Registry->Register(this);
+	}
 }
 
 void UInteractableManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	// Clean up timer
+	// Leave the billboard batch
 	StopCameraFacingUpdates();
+
+	// Hold/mash timers
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(HoldCompleteTimerHandle);
+		World->GetTimerManager().ClearTimer(MashDecayTimerHandle);
+	}
+
+	if (UInteractableRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UInteractableRegistrySubsystem>())
+	{
+		Registry->Unregister(this);
+	}
 	
 	Super::EndPlay(EndPlayReason);
 }
@@ -126,8 +146,8 @@ void UInteractableManager::CreateWidgetComponent()
 	// Background
 	WidgetComponent->SetBackgroundColor(FLinearColor::Transparent);
 	
-	// Hidden by default
-	WidgetComponent->SetVisibility(false);
+	// Hidden by default (and not ticking until shown)
+	SetWidgetShown(false);
 
 	UE_LOG(LogTemp, Log, TEXT("InteractableManager: Created high-quality widget for %s (Type: %s, CameraFacing: %s)"), 
 		*Owner->GetName(),
@@ -194,6 +214,28 @@ bool UInteractableManager::CanInteract_Implementation(AActor* Interactor) const
 	return Config.bCanInteract;
 }
 
+void UInteractableManager::SetCanInteract(bool bNewCanInteract)
+{
+	const bool bWasEnabled = Config.bCanInteract;
+	Config.bCanInteract = bNewCanInteract;
+
+	// Let nearby scanners pick it up (or drop it) without waiting for motion
+	if (bNewCanInteract != bWasEnabled)
+	{
+		if (UInteractableRegistrySubsystem* Registry = GetWorld() ? GetWorld()->GetSubsystem<UInteractableRegistrySubsystem>() : nullptr)
+		{
+			if (bNewCanInteract)
+			{
+				Registry->NotifyInteractableEnabled(this);
+			}
+			else
+			{
+				Registry->NotifyInteractableDisabled(this);
+			}
+		}
+	}
+}
+
 void UInteractableManager::OnBeginFocus_Implementation(AActor* Interactor)
 {
 	// Store current interactor for camera-facing
@@ -208,7 +250,7 @@ void UInteractableManager::OnBeginFocus_Implementation(AActor* Interactor)
 	// Show widget
 	if (WidgetComponent)
 	{
-		WidgetComponent->SetVisibility(true);
+		SetWidgetShown(true);
 
 		// Update widget with interaction-type-specific text
 		if (UInteractableWidget* Widget = Cast<UInteractableWidget>(WidgetComponent->GetWidget()))
@@ -244,8 +286,9 @@ void UInteractableManager::OnEndFocus_Implementation(AActor* Interactor)
 	// Clear current interactor
 	CurrentInteractor = nullptr;
 
-	// Stop camera-facing updates
-	StopCameraFacingUpdates();
+	// Looking away ends any hold/mash in progress - bCanCancelHold only guards the button
+	CancelHold(Interactor);
+	CancelMash();
 
 	// Remove highlight
 	if (bEnableHighlight)
@@ -253,10 +296,10 @@ void UInteractableManager::OnEndFocus_Implementation(AActor* Interactor)
 		ApplyHighlight(false);
 	}
 
-	// Hide widget
+	// Hide widget (also leaves the billboard batch)
 	if (WidgetComponent)
 	{
-		WidgetComponent->SetVisibility(false);
+		SetWidgetShown(false);
 	}
 
 	// Broadcast event
@@ -470,6 +513,211 @@ void UInteractableManager::SetProgressBarVisible(bool bVisible)
 	}
 }
 
+// ═══════════════════════════════════════════════════════════════════════
+// HOLD / MASH PROGRESS (timestamp-driven)
+// ═══════════════════════════════════════════════════════════════════════
+
+void UInteractableManager::BeginHold(AActor* Interactor)
+{
+	UWorld* World = GetWorld();
+	if (bHoldActive || !World)
+	{
+		return;
+	}
+
+	bHoldActive = true;
+	ProgressInteractor = Interactor;
+	HoldStartTime = GetWorldTime();
+	ActiveHoldDuration = FMath::Max(IInteractable::Execute_GetHoldDuration(this), KINDA_SMALL_NUMBER);
+
+	// OPTIMIZATION: One timer for completion - progress is computed from HoldStartTime when read
+	World->GetTimerManager().SetTimer(HoldCompleteTimerHandle, this, &UInteractableManager::OnHoldTimerComplete, ActiveHoldDuration, false);
+
+	IInteractable::Execute_OnHoldInteractionStart(this, Interactor);
+	BindWidgetProgress(false);
+}
+
+void UInteractableManager::ReleaseHold(AActor* Interactor)
+{
+	// Uncancellable holds run to completion once started
+	if (Config.bCanCancelHold)
+	{
+		CancelHold(Interactor);
+	}
+}
+
+void UInteractableManager::CancelHold(AActor* Interactor)
+{
+	if (!bHoldActive)
+	{
+		return;
+	}
+
+	GetWorld()->GetTimerManager().ClearTimer(HoldCompleteTimerHandle);
+	bHoldActive = false;
+	ProgressInteractor = nullptr;
+
+	SetWidgetProgressState(EInteractionWidgetState::IWS_Cancelled);
+	IInteractable::Execute_OnHoldInteractionCancelled(this, Interactor);
+}
+
+float UInteractableManager::GetHoldProgress() const
+{
+	if (!bHoldActive)
+	{
+		return 0.0f;
+	}
+
+	return FMath::Clamp(static_cast<float>(GetWorldTime() - HoldStartTime) / ActiveHoldDuration, 0.0f, 1.0f);
+}
+
+void UInteractableManager::OnHoldTimerComplete()
+{
+	if (!bHoldActive)
+	{
+		return;
+	}
+
+	AActor* Interactor = ProgressInteractor;
+	bHoldActive = false;
+	ProgressInteractor = nullptr;
+
+	SetWidgetProgressState(EInteractionWidgetState::IWS_Completed);
+	IInteractable::Execute_OnHoldInteractionComplete(this, Interactor);
+}
+
+void UInteractableManager::RegisterMashPress(AActor* Interactor)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const double Now = GetWorldTime();
+
+	if (!bMashActive)
+	{
+		bMashActive = true;
+		ProgressInteractor = Interactor;
+		MashValue = 0.0f;
+		MashValueTime = Now;
+		ActiveMashRequired = FMath::Max(IInteractable::Execute_GetRequiredMashCount(this), 1);
+		ActiveMashDecayRate = FMath::Max(IInteractable::Execute_GetMashDecayRate(this), 0.0f);
+
+		IInteractable::Execute_OnMashInteractionStart(this, Interactor);
+		BindWidgetProgress(true);
+	}
+
+	// Fold the decay since the last press into the stored count, then add this press
+	MashValue = GetDecayedMashValue(Now) + 1.0f;
+	MashValueTime = Now;
+
+	const float Progress = FMath::Clamp(MashValue / ActiveMashRequired, 0.0f, 1.0f);
+	IInteractable::Execute_OnMashInteractionUpdate(this, Interactor, FMath::FloorToInt(MashValue), ActiveMashRequired, Progress);
+
+	if (MashValue >= ActiveMashRequired)
+	{
+		World->GetTimerManager().ClearTimer(MashDecayTimerHandle);
+		bMashActive = false;
+		ProgressInteractor = nullptr;
+
+		SetWidgetProgressState(EInteractionWidgetState::IWS_Completed);
+		IInteractable::Execute_OnMashInteractionComplete(this, Interactor);
+		return;
+	}
+
+	// OPTIMIZATION: One timer for "decayed to zero" instead of ticking the decay
+	if (ActiveMashDecayRate > 0.0f)
+	{
+		World->GetTimerManager().SetTimer(MashDecayTimerHandle, this, &UInteractableManager::OnMashDecayedOut, MashValue / ActiveMashDecayRate, false);
+	}
+}
+
+void UInteractableManager::CancelMash()
+{
+	if (!bMashActive)
+	{
+		return;
+	}
+
+	GetWorld()->GetTimerManager().ClearTimer(MashDecayTimerHandle);
+	bMashActive = false;
+	ProgressInteractor = nullptr;
+	MashValue = 0.0f;
+
+	SetWidgetProgressState(EInteractionWidgetState::IWS_Cancelled);
+	SetProgressBarVisible(false);
+}
+
+float UInteractableManager::GetMashProgress() const
+{
+	if (!bMashActive)
+	{
+		return 0.0f;
+	}
+
+	return FMath::Clamp(GetDecayedMashValue(GetWorldTime()) / ActiveMashRequired, 0.0f, 1.0f);
+}
+
+void UInteractableManager::OnMashDecayedOut()
+{
+	if (!bMashActive)
+	{
+		return;
+	}
+
+	AActor* Interactor = ProgressInteractor;
+	bMashActive = false;
+	ProgressInteractor = nullptr;
+	MashValue = 0.0f;
+
+	SetWidgetProgressState(EInteractionWidgetState::IWS_Cancelled);
+	IInteractable::Execute_OnMashInteractionFailed(this, Interactor);
+}
+
+float UInteractableManager::GetDecayedMashValue(double Now) const
+{
+	const float Elapsed = static_cast<float>(Now - MashValueTime);
+	return FMath::Max(0.0f, MashValue - Elapsed * ActiveMashDecayRate);
+}
+
+void UInteractableManager::BindWidgetProgress(bool bMash)
+{
+	if (!WidgetComponent)
+	{
+		return;
+	}
+
+	if (UInteractableWidget* Widget = Cast<UInteractableWidget>(WidgetComponent->GetWidget()))
+	{
+		Widget->SetWidgetState(bMash ? EInteractionWidgetState::IWS_Mashing : EInteractionWidgetState::IWS_Holding);
+		Widget->SetProgressSampler(bMash
+			? FInteractionProgressSampler::CreateUObject(this, &UInteractableManager::GetMashProgress)
+			: FInteractionProgressSampler::CreateUObject(this, &UInteractableManager::GetHoldProgress));
+	}
+}
+
+void UInteractableManager::SetWidgetProgressState(EInteractionWidgetState NewState)
+{
+	if (!WidgetComponent)
+	{
+		return;
+	}
+
+	// Leaving Holding/Mashing also unbinds the sampler
+	if (UInteractableWidget* Widget = Cast<UInteractableWidget>(WidgetComponent->GetWidget()))
+	{
+		Widget->SetWidgetState(NewState);
+	}
+}
+
+double UInteractableManager::GetWorldTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
 // ═══════════════════════════════════════════════════════════════════════
 // BLUEPRINT CALLABLE
 // ═══════════════════════════════════════════════════════════════════════
@@ -515,15 +763,22 @@ void UInteractableManager::UpdateWidgetRotationToFaceCamera(AActor* Interactor,
 		return;
 	}
 
+	UpdateBillboard(CameraLocation, DeltaTime);
+}
+
+void UInteractableManager::UpdateBillboard(const FVector& CameraLocation, float DeltaTime)
+{
+	if (!WidgetComponent)
+	{
+		return;
+	}
+
 	// Calculate direction from widget to camera
 	const FVector WidgetLocation = WidgetComponent->GetComponentLocation();
 	const FVector DirectionToCamera = (CameraLocation - WidgetLocation).GetSafeNormal();
 
 	// Calculate target rotation (face camera)
-	FRotator TargetRotation = DirectionToCamera.Rotation();
-	
-	// Get current rotation
-	FRotator CurrentRotation = WidgetComponent->GetComponentRotation();
+	const FRotator TargetRotation = DirectionToCamera.Rotation();
 
 	// Apply rotation (smooth or instant)
 	FRotator NewRotation;
@@ -531,7 +786,7 @@ void UInteractableManager::UpdateWidgetRotationToFaceCamera(AActor* Interactor,
 	if (RotationSmoothSpeed > 0.0f && DeltaTime > 0.0f)
 	{
 		// Smooth interpolation
-		NewRotation = FMath::RInterpTo(CurrentRotation, TargetRotation, DeltaTime, RotationSmoothSpeed);
+		NewRotation = FMath::RInterpTo(WidgetComponent->GetComponentRotation(), TargetRotation, DeltaTime, RotationSmoothSpeed);
 	}
 	else
 	{
@@ -600,22 +855,10 @@ void UInteractableManager::StartCameraFacingUpdates()
 		return;
 	}
 
-	// Clear existing timer
-	StopCameraFacingUpdates();
-
-	// Start new timer
-	if (UWorld* World = GetWorld())
+	// OPTIMIZATION: One batched per-frame pass in the subsystem instead of a looping timer per interactable
+	if (UInteractableBillboardSubsystem* Billboards = GetWorld()->GetSubsystem<UInteractableBillboardSubsystem>())
 	{
-		World->GetTimerManager().SetTimer(
-			CameraFacingTimerHandle,
-			this,
-			&UInteractableManager::UpdateCameraFacingTimer,
-			CameraFacingUpdateRate,
-			true // Looping
-		);
-
-		UE_LOG(LogTemp, Verbose, TEXT("InteractableManager: Started camera-facing timer (Rate: %.3fs)"),
-			CameraFacingUpdateRate);
+		Billboards->Register(this);
 	}
 }
 
@@ -623,19 +866,22 @@ void UInteractableManager::StopCameraFacingUpdates()
 {
 	if (UWorld* World = GetWorld())
 	{
-		World->GetTimerManager().ClearTimer(CameraFacingTimerHandle);
+		if (UInteractableBillboardSubsystem* Billboards = World->GetSubsystem<UInteractableBillboardSubsystem>())
+		{
+			Billboards->Unregister(this);
+		}
 	}
 }
 
-void UInteractableManager::UpdateCameraFacingTimer()
+void UInteractableManager::SetWidgetShown(bool bShown)
 {
-	if (CurrentInteractor && WidgetComponent && WidgetComponent->IsVisible())
-	{
-		UpdateWidgetRotationToFaceCamera(CurrentInteractor, CameraFacingUpdateRate);
-	}
-	else
+	WidgetComponent->SetVisibility(bShown);
+
+	// A hidden widget has nothing to render - don't pay for its tick either
+	WidgetComponent->SetComponentTickEnabled(bShown);
+
+	if (!bShown)
 	{
-		// Stop timer if no longer needed
 		StopCameraFacingUpdates();
 	}
 }
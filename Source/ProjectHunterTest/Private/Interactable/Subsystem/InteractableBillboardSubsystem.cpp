@@ -0,0 +1,163 @@
+// Interactable/Subsystem/InteractableBillboardSubsystem.cpp
+
+#include "Interactable/Subsystem/InteractableBillboardSubsystem.h"
+#include "Interactable/Component/InteractableManager.h"
+#include "Components/WidgetComponent.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+
+// ═══════════════════════════════════════════════════════════════════════
+// SUBSYSTEM LIFECYCLE
+// ═══════════════════════════════════════════════════════════════════════
+
+void UInteractableBillboardSubsystem::Deinitialize()
+{
+	Billboards.Empty();
+	NumUpdatedLastFrame = 0;
+
+	Super::Deinitialize();
+}
+
+bool UInteractableBillboardSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Nobody looks at widgets on a dedicated server
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// REGISTRATION
+// ═══════════════════════════════════════════════════════════════════════
+
+void UInteractableBillboardSubsystem::Register(UInteractableManager* Interactable)
+{
+	if (!Interactable)
+	{
+		return;
+	}
+
+	for (const FBillboardEntry& Entry : Billboards)
+	{
+		if (Entry.Interactable.Get() == Interactable)
+		{
+			return;
+		}
+	}
+
+	FBillboardEntry& Entry = Billboards.AddDefaulted_GetRef();
+	Entry.Interactable = Interactable;
+}
+
+void UInteractableBillboardSubsystem::Unregister(UInteractableManager* Interactable)
+{
+	for (int32 Index = 0; Index < Billboards.Num(); ++Index)
+	{
+		if (Billboards[Index].Interactable.Get() == Interactable)
+		{
+			Billboards.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			return;
+		}
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// PER-FRAME UPDATE
+// ═══════════════════════════════════════════════════════════════════════
+
+void UInteractableBillboardSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	NumUpdatedLastFrame = 0;
+
+	TArray<FBillboardView, TInlineAllocator<4>> Views;
+	GatherViews(Views);
+
+	const float MaxDistanceSq = FMath::Square(MaxBillboardDistance);
+
+	for (int32 Index = Billboards.Num() - 1; Index >= 0; --Index)
+	{
+		FBillboardEntry& Entry = Billboards[Index];
+		UInteractableManager* Interactable = Entry.Interactable.Get();
+		UWidgetComponent* Widget = Interactable ? Interactable->GetWidgetComponent() : nullptr;
+
+		// Owner destroyed or widget hidden without unregistering
+		if (!Widget || !Widget->IsVisible())
+		{
+			Billboards.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		Entry.PendingTime += DeltaTime;
+
+		// Honour the interactable's own update rate
+		if (Entry.PendingTime < Interactable->CameraFacingUpdateRate)
+		{
+			continue;
+		}
+
+		// Nearest local camera that can actually see the widget
+		const FVector WidgetLocation = Widget->GetComponentLocation();
+		const FBillboardView* BestView = nullptr;
+		float BestDistanceSq = MaxDistanceSq;
+
+		for (const FBillboardView& View : Views)
+		{
+			const FVector ToWidget = WidgetLocation - View.Location;
+			const float DistanceSq = ToWidget.SizeSquared();
+			if (DistanceSq > BestDistanceSq)
+			{
+				continue;
+			}
+
+			if (DistanceSq > KINDA_SMALL_NUMBER &&
+				FVector::DotProduct(ToWidget, View.Forward) < View.CosHalfCone * FMath::Sqrt(DistanceSq))
+			{
+				continue;
+			}
+
+			BestView = &View;
+			BestDistanceSq = DistanceSq;
+		}
+
+		if (!BestView)
+		{
+			// Off screen or out of range - keep PendingTime so smoothing catches up later
+			continue;
+		}
+
+		Interactable->UpdateBillboard(BestView->Location, Entry.PendingTime);
+		Entry.PendingTime = 0.0f;
+		++NumUpdatedLastFrame;
+	}
+}
+
+void UInteractableBillboardSubsystem::GatherViews(TArray<FBillboardView, TInlineAllocator<4>>& OutViews) const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* PC = It->Get();
+		if (!PC || !PC->IsLocalController())
+		{
+			continue;
+		}
+
+		FVector Location;
+		FRotator Rotation;
+		PC->GetPlayerViewPoint(Location, Rotation);
+
+		const float FOV = PC->PlayerCameraManager ? PC->PlayerCameraManager->GetFOVAngle() : 90.0f;
+		const float HalfCone = FMath::Min(FOV * 0.5f + ViewConeMargin, 180.0f);
+
+		FBillboardView& View = OutViews.AddDefaulted_GetRef();
+		View.Location = Location;
+		View.Forward = Rotation.Vector();
+		View.CosHalfCone = FMath::Cos(FMath::DegreesToRadians(HalfCone));
+	}
+}
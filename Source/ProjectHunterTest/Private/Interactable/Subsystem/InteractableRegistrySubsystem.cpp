@@ -0,0 +1,198 @@
+// Interactable/Subsystem/InteractableRegistrySubsystem.cpp
+
+#include "Interactable/Subsystem/InteractableRegistrySubsystem.h"
+#include "Interactable/Component/InteractableManager.h"
+#include "Interactable/Interface/Interactable.h"
+#include "GameFramework/Actor.h"
+
+DEFINE_LOG_CATEGORY(LogInteractableRegistry);
+
+UInteractableRegistrySubsystem::UInteractableRegistrySubsystem()
+	: SpatialIndex(CellSize)
+{
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// SUBSYSTEM LIFECYCLE
+// ═══════════════════════════════════════════════════════════════════════
+
+void UInteractableRegistrySubsystem::Deinitialize()
+{
+	for (FEntry& Entry : Entries)
+	{
+		if (USceneComponent* Root = Entry.Root.Get())
+		{
+			Root->TransformUpdated.Remove(Entry.TransformHandle);
+		}
+	}
+
+	Entries.Empty();
+	ActorToHandle.Empty();
+	SpatialIndex.Reset();
+
+	Super::Deinitialize();
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// REGISTRATION
+// ═══════════════════════════════════════════════════════════════════════
+
+void UInteractableRegistrySubsystem::Register(UInteractableManager* Interactable)
+{
+	AActor* Owner = Interactable ? Interactable->GetOwner() : nullptr;
+	if (!Owner || ActorToHandle.Contains(Owner))
+	{
+		return;
+	}
+
+	FEntry NewEntry;
+	NewEntry.Interactable = Interactable;
+	NewEntry.Root = Owner->GetRootComponent();
+	NewEntry.Location = Owner->GetActorLocation();
+
+	const int32 Handle = Entries.Add(MoveTemp(NewEntry));
+	FEntry& Entry = Entries[Handle];
+
+	ActorToHandle.Add(Owner, Handle);
+	SpatialIndex.Add(Handle, Entry.Location);
+
+	// Only movable owners can leave their cell
+	USceneComponent* Root = Entry.Root.Get();
+	if (Root && Root->Mobility == EComponentMobility::Movable)
+	{
+		Entry.TransformHandle = Root->TransformUpdated.AddUObject(this, &UInteractableRegistrySubsystem::OnRootTransformUpdated, Handle);
+	}
+
+	UE_LOG(LogInteractableRegistry, Verbose, TEXT("InteractableRegistry: Registered %s (handle %d)"), *Owner->GetName(), Handle);
+
+	OnInteractableAvailable.Broadcast(Interactable);
+}
+
+void UInteractableRegistrySubsystem::Unregister(UInteractableManager* Interactable)
+{
+	AActor* Owner = Interactable ? Interactable->GetOwner() : nullptr;
+	if (!Owner)
+	{
+		return;
+	}
+
+	const int32* Handle = ActorToHandle.Find(Owner);
+	if (!Handle || Entries[*Handle].Interactable.Get() != Interactable)
+	{
+		return;
+	}
+
+	UE_LOG(LogInteractableRegistry, Verbose, TEXT("InteractableRegistry: Unregistered %s (handle %d)"), *Owner->GetName(), *Handle);
+
+	const int32 HandleValue = *Handle;
+	ActorToHandle.Remove(Owner);
+	RemoveEntry(HandleValue);
+
+	OnInteractableUnavailable.Broadcast(Interactable);
+}
+
+void UInteractableRegistrySubsystem::NotifyInteractableEnabled(UInteractableManager* Interactable)
+{
+	if (FindInteractable(Interactable ? Interactable->GetOwner() : nullptr) == Interactable)
+	{
+		OnInteractableAvailable.Broadcast(Interactable);
+	}
+}
+
+void UInteractableRegistrySubsystem::NotifyInteractableDisabled(UInteractableManager* Interactable)
+{
+	if (FindInteractable(Interactable ? Interactable->GetOwner() : nullptr) == Interactable)
+	{
+		OnInteractableUnavailable.Broadcast(Interactable);
+	}
+}
+
+void UInteractableRegistrySubsystem::RemoveEntry(int32 Handle)
+{
+	FEntry& Entry = Entries[Handle];
+
+	if (USceneComponent* Root = Entry.Root.Get())
+	{
+		Root->TransformUpdated.Remove(Entry.TransformHandle);
+	}
+
+	SpatialIndex.Remove(Handle, Entry.Location);
+	Entries.RemoveAt(Handle);
+}
+
+void UInteractableRegistrySubsystem::OnRootTransformUpdated(USceneComponent* Root, EUpdateTransformFlags Flags, ETeleportType Teleport, int32 Handle)
+{
+	if (!Entries.IsValidIndex(Handle) || !Root)
+	{
+		return;
+	}
+
+	FEntry& Entry = Entries[Handle];
+	const FVector NewLocation = Root->GetComponentLocation();
+
+	SpatialIndex.Move(Handle, Entry.Location, NewLocation);
+	Entry.Location = NewLocation;
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// LOOKUP
+// ═══════════════════════════════════════════════════════════════════════
+
+UInteractableManager* UInteractableRegistrySubsystem::FindInteractable(const AActor* Actor) const
+{
+	if (!Actor)
+	{
+		return nullptr;
+	}
+
+	const int32* Handle = ActorToHandle.Find(Actor);
+	return Handle ? Entries[*Handle].Interactable.Get() : nullptr;
+}
+
+TScriptInterface<IInteractable> UInteractableRegistrySubsystem::ResolveInteractable(AActor* Actor) const
+{
+	TScriptInterface<IInteractable> Result;
+
+	if (UInteractableManager* Interactable = FindInteractable(Actor))
+	{
+		Result.SetObject(Interactable);
+		Result.SetInterface(Cast<IInteractable>(Interactable));
+	}
+	else if (Actor && Actor->GetClass()->ImplementsInterface(UInteractable::StaticClass()))
+	{
+		Result.SetObject(Actor);
+		Result.SetInterface(Cast<IInteractable>(Actor));
+	}
+
+	return Result;
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// SPATIAL QUERIES
+// ═══════════════════════════════════════════════════════════════════════
+
+int32 UInteractableRegistrySubsystem::GetInteractablesInRadius(FVector Location, float Radius, TArray<UInteractableManager*>& OutInteractables) const
+{
+	const int32 StartNum = OutInteractables.Num();
+
+	SpatialIndex.ForEachInRadius(Location, Radius, [this, &OutInteractables](int32 Handle, const FVector&)
+	{
+		if (UInteractableManager* Interactable = Entries[Handle].Interactable.Get())
+		{
+			OutInteractables.Add(Interactable);
+		}
+	});
+
+	return OutInteractables.Num() - StartNum;
+}
+
+UInteractableManager* UInteractableRegistrySubsystem::FindNearestInteractable(FVector Location, float MaxDistance) const
+{
+	const int32 Handle = SpatialIndex.FindNearest(Location, MaxDistance);
+	return Handle != INDEX_NONE ? Entries[Handle].Interactable.Get() : nullptr;
+}
+
+bool UInteractableRegistrySubsystem::HasInteractableInRadius(const FVector& Location, float Radius) const
+{
+	return SpatialIndex.FindNearest(Location, Radius) != INDEX_NONE;
+}
@@ -0,0 +1,216 @@
+// Interactable/Subsystem/InteractionInputSubsystem.cpp
+
+#include "Interactable/Subsystem/InteractionInputSubsystem.h"
+#include "EnhancedInputSubsystems.h"
+#include "InputAction.h"
+#include "Engine/LocalPlayer.h"
+#include "Framework/Application/IInputProcessor.h"
+#include "Framework/Application/SlateApplication.h"
+
+DEFINE_LOG_CATEGORY(LogInteractionInput);
+
+// ═══════════════════════════════════════════════════════════════════════
+// INPUT PROCESSOR
+// ═══════════════════════════════════════════════════════════════════════
+
+/**
+ * Watches raw Slate input for device switches. Never consumes events.
+ */
+class FInteractionInputProcessor : public IInputProcessor
+{
+public:
+	FInteractionInputProcessor(UInteractionInputSubsystem* InOwner, int32 InUserIndex)
+		: Owner(InOwner)
+		, UserIndex(InUserIndex)
+	{
+	}
+
+	virtual void Tick(const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor) override
+	{
+	}
+
+	virtual bool HandleKeyDownEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent) override
+	{
+		if (InKeyEvent.GetUserIndex() == UserIndex)
+		{
+			SetDevice(InKeyEvent.GetKey().IsGamepadKey()
+				? EInteractionInputDevice::IID_Gamepad
+				: EInteractionInputDevice::IID_KeyboardMouse);
+		}
+		return false;
+	}
+
+	virtual bool HandleAnalogInputEvent(FSlateApplication& SlateApp, const FAnalogInputEvent& InAnalogInputEvent) override
+	{
+		// Stick noise below the threshold is not a switch
+		if (InAnalogInputEvent.GetUserIndex() == UserIndex && InAnalogInputEvent.GetKey().IsGamepadKey())
+		{
+			const UInteractionInputSubsystem* Subsystem = Owner.Get();
+			if (Subsystem && FMath::Abs(InAnalogInputEvent.GetAnalogValue()) > Subsystem->GamepadAnalogThreshold)
+			{
+				SetDevice(EInteractionInputDevice::IID_Gamepad);
+			}
+		}
+		return false;
+	}
+
+	virtual bool HandleMouseMoveEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override
+	{
+		if (MouseEvent.GetUserIndex() == UserIndex && !MouseEvent.GetCursorDelta().IsNearlyZero())
+		{
+			SetDevice(EInteractionInputDevice::IID_KeyboardMouse);
+		}
+		return false;
+	}
+
+	virtual bool HandleMouseButtonDownEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override
+	{
+		if (MouseEvent.GetUserIndex() == UserIndex)
+		{
+			SetDevice(EInteractionInputDevice::IID_KeyboardMouse);
+		}
+		return false;
+	}
+
+	virtual const TCHAR* GetDebugName() const override { return TEXT("InteractionInputProcessor"); }
+
+private:
+	void SetDevice(EInteractionInputDevice NewDevice)
+	{
+		if (UInteractionInputSubsystem* Subsystem = Owner.Get())
+		{
+			Subsystem->SetCurrentInputDevice(NewDevice);
+		}
+	}
+
+	TWeakObjectPtr<UInteractionInputSubsystem> Owner;
+	int32 UserIndex;
+};
+
+// ═══════════════════════════════════════════════════════════════════════
+// SUBSYSTEM LIFECYCLE
+// ═══════════════════════════════════════════════════════════════════════
+
+void UInteractionInputSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Collection.InitializeDependency<UEnhancedInputLocalPlayerSubsystem>();
+
+	Super::Initialize(Collection);
+
+	ULocalPlayer* LocalPlayer = GetLocalPlayer();
+
+	EnhancedInput = LocalPlayer ? LocalPlayer->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>() : nullptr;
+	if (EnhancedInput)
+	{
+		EnhancedInput->ControlMappingsRebuiltDelegate.AddDynamic(this, &UInteractionInputSubsystem::HandleControlMappingsRebuilt);
+	}
+
+	// No Slate in commandlets / dedicated servers - device stays keyboard
+	if (LocalPlayer && FSlateApplication::IsInitialized())
+	{
+		InputProcessor = MakeShared<FInteractionInputProcessor>(this, LocalPlayer->GetPlatformUserIndex());
+		FSlateApplication::Get().RegisterInputPreProcessor(InputProcessor);
+	}
+}
+
+void UInteractionInputSubsystem::Deinitialize()
+{
+	if (InputProcessor.IsValid() && FSlateApplication::IsInitialized())
+	{
+		FSlateApplication::Get().UnregisterInputPreProcessor(InputProcessor);
+	}
+	InputProcessor.Reset();
+
+	if (EnhancedInput)
+	{
+		EnhancedInput->ControlMappingsRebuiltDelegate.RemoveAll(this);
+		EnhancedInput = nullptr;
+	}
+
+	ActionKeys.Empty();
+	OnInputDeviceChanged.Clear();
+	OnKeyBindingsChanged.Clear();
+
+	Super::Deinitialize();
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// INPUT DEVICE
+// ═══════════════════════════════════════════════════════════════════════
+
+void UInteractionInputSubsystem::SetCurrentInputDevice(EInteractionInputDevice NewDevice)
+{
+	if (CurrentDevice == NewDevice)
+	{
+		return;
+	}
+
+	CurrentDevice = NewDevice;
+
+	UE_LOG(LogInteractionInput, Verbose, TEXT("Input device changed to: %s"),
+		*UEnum::GetValueAsString(NewDevice));
+
+	OnInputDeviceChanged.Broadcast(NewDevice);
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// KEY BINDINGS
+// ═══════════════════════════════════════════════════════════════════════
+
+FKey UInteractionInputSubsystem::GetKeyForAction(const UInputAction* InputAction) const
+{
+	if (!InputAction)
+	{
+		return EKeys::Invalid;
+	}
+
+	const FActionKeys* Keys = ActionKeys.Find(InputAction);
+	if (!Keys)
+	{
+		Keys = &ActionKeys.Add(InputAction, ResolveActionKeys(InputAction));
+	}
+
+	const bool bGamepad = IsUsingGamepad();
+	const FKey& Preferred = bGamepad ? Keys->GamepadKey : Keys->KeyboardKey;
+	const FKey& Fallback = bGamepad ? Keys->KeyboardKey : Keys->GamepadKey;
+
+	return Preferred.IsValid() ? Preferred : Fallback;
+}
+
+void UInteractionInputSubsystem::InvalidateKeyBindings()
+{
+	ActionKeys.Reset();
+	OnKeyBindingsChanged.Broadcast();
+}
+
+UInteractionInputSubsystem::FActionKeys UInteractionInputSubsystem::ResolveActionKeys(const UInputAction* InputAction) const
+{
+	FActionKeys Keys;
+
+	if (!EnhancedInput)
+	{
+		return Keys;
+	}
+
+	for (const FKey& Key : EnhancedInput->QueryKeysMappedToAction(InputAction))
+	{
+		FKey& Slot = Key.IsGamepadKey() ? Keys.GamepadKey : Keys.KeyboardKey;
+		if (!Slot.IsValid())
+		{
+			Slot = Key;
+		}
+	}
+
+	if (!Keys.KeyboardKey.IsValid() && !Keys.GamepadKey.IsValid())
+	{
+		UE_LOG(LogInteractionInput, Warning, TEXT("No key binding found for InputAction '%s'!"),
+			*InputAction->GetName());
+	}
+
+	return Keys;
+}
+
+void UInteractionInputSubsystem::HandleControlMappingsRebuilt()
+{
+	InvalidateKeyBindings();
+}
@@ -1,16 +1,14 @@
 // Interactable/Widget/InteractableWidget.cpp
 
 #include "Interactable/Widget/InteractableWidget.h"
+#include "Interactable/Subsystem/InteractionInputSubsystem.h"
 #include "Components/Image.h"
 #include "Components/TextBlock.h"
 #include "Components/Overlay.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/PlayerController.h"
-#include "EnhancedInputSubsystems.h"
-#include "EnhancedInputComponent.h"
-#include "InputMappingContext.h"
-#include "PlayerMappableInputConfig.h"
+#include "Engine/LocalPlayer.h"
 
 DEFINE_LOG_CATEGORY(LogInteractableWidget);
 
@@ -22,6 +20,14 @@ void UInteractableWidget::NativeConstruct()
 {
 	Super::NativeConstruct();
 
+	// Device and binding changes are pushed to us - nothing to poll
+	InputSubsystem = GetInteractionInputSubsystem();
+	if (UInteractionInputSubsystem* Input = InputSubsystem.Get())
+	{
+		InputDeviceChangedHandle = Input->OnInputDeviceChanged.AddUObject(this, &UInteractableWidget::HandleInputDeviceChanged);
+		KeyBindingsChangedHandle = Input->OnKeyBindingsChanged.AddUObject(this, &UInteractableWidget::HandleKeyBindingsChanged);
+	}
+
 	// Detect initial input mode
 	bIsUsingGamepad = DetectGamepadMode();
 	bLastInputModeGamepad = bIsUsingGamepad;
@@ -38,6 +44,15 @@ void UInteractableWidget::NativeConstruct()
 
 void UInteractableWidget::NativeDestruct()
 {
+	if (UInteractionInputSubsystem* Input = InputSubsystem.Get())
+	{
+		Input->OnInputDeviceChanged.Remove(InputDeviceChangedHandle);
+		Input->OnKeyBindingsChanged.Remove(KeyBindingsChangedHandle);
+	}
+	InputSubsystem.Reset();
+	InputDeviceChangedHandle.Reset();
+	KeyBindingsChangedHandle.Reset();
+
 	BorderMID = nullptr;
 	Super::NativeDestruct();
 }
@@ -46,30 +61,7 @@ void UInteractableWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaT
 {
 	Super::NativeTick(MyGeometry, InDeltaTime);
 
-	// ═══════════════════════════════════════════════
-	// INPUT MODE DETECTION (Only check periodically, not every frame)
-	// ═══════════════════════════════════════════════
-	static float InputCheckAccumulator = 0.0f;
-	InputCheckAccumulator += InDeltaTime;
-	
-	if (InputCheckAccumulator >= 0.25f)  // Check every 250ms
-	{
-		InputCheckAccumulator = 0.0f;
-		
-		bool bCurrentlyGamepad = DetectGamepadMode();
-		if (bCurrentlyGamepad != bIsUsingGamepad)
-		{
-			bIsUsingGamepad = bCurrentlyGamepad;
-			RefreshInputMode();
-			
-			UE_LOG(LogInteractableWidget, Verbose, TEXT("Input mode changed to: %s"),
-				bIsUsingGamepad ? TEXT("Gamepad") : TEXT("Keyboard"));
-		}
-	}
-
-	// ═══════════════════════════════════════════════
-	// STATE-SPECIFIC TICK
-	// ═══════════════════════════════════════════════
+	// Input mode changes arrive via HandleInputDeviceChanged - only visual state ticks here
 	TickState(InDeltaTime);
 }
 
@@ -83,6 +75,7 @@ void UInteractableWidget::SetInteractionData(UInputAction* InputAction, const FT
 	{
 		UE_LOG(LogInteractableWidget, Warning, TEXT("SetInteractionData called with null InputAction!"));
 		CurrentInputKey = EKeys::Invalid;
+		CurrentInputAction = nullptr;
 		
 		// Still update description
 		if (InteractionDescription)
@@ -97,8 +90,9 @@ void UInteractableWidget::SetInteractionData(UInputAction* InputAction, const FT
 	// ═══════════════════════════════════════════════
 	FKey BoundKey = GetBoundKeyForInputAction(InputAction);
 	
-	// Use the direct key setter
+	// Use the direct key setter, then remember the action for re-resolving on change
 	SetInteractionDataWithKey(BoundKey, Description);
+	CurrentInputAction = InputAction;
 
 	UE_LOG(LogInteractableWidget, Verbose, TEXT("SetInteractionData: InputAction='%s', BoundKey='%s', Description='%s'"),
 		*InputAction->GetName(), *BoundKey.ToString(), *Description.ToString());
@@ -107,6 +101,7 @@ void UInteractableWidget::SetInteractionData(UInputAction* InputAction, const FT
 void UInteractableWidget::SetInteractionDataWithKey(const FKey& Key, const FText& Description)
 {
 	CurrentInputKey = Key;
+	CurrentInputAction = nullptr;
 
 	// Update description text
 	if (InteractionDescription)
@@ -132,6 +127,12 @@ void UInteractableWidget::SetWidgetState(EInteractionWidgetState NewState)
 	CurrentState = NewState;
 	StateTimer = 0.0f;
 
+	// Sampler only drives Holding/Mashing - don't leave a stale source behind
+	if (NewState != EInteractionWidgetState::IWS_Holding && NewState != EInteractionWidgetState::IWS_Mashing)
+	{
+		ProgressSampler.Unbind();
+	}
+
 	// State entry logic
 	switch (NewState)
 	{
@@ -245,8 +246,12 @@ void UInteractableWidget::TickState(float DeltaTime)
 		case EInteractionWidgetState::IWS_Holding:
 		case EInteractionWidgetState::IWS_Mashing:
 		{
-			// Progress is set externally via SetProgress()
-			// Nothing to tick here - material updates happen in SetProgress()
+			// OPTIMIZATION: Progress is computed from timestamps on read - sample it only while we're drawn
+			// (SetProgress skips the material update when nothing changed)
+			if (ProgressSampler.IsBound())
+			{
+				SetProgress(ProgressSampler.Execute());
+			}
 			break;
 		}
 
@@ -441,45 +446,33 @@ void UInteractableWidget::UpdateKeyIcon()
 
 bool UInteractableWidget::DetectGamepadMode() const
 {
-	APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0);
-	if (!PC)
-	{
-		return false;
-	}
+	const UInteractionInputSubsystem* Input = InputSubsystem.Get();
+	return Input && Input->IsUsingGamepad();
+}
 
-	// Check for any recent gamepad input
-	// This is a simple heuristic - for production, use InputDeviceMapper or similar
-	
-	// Check analog sticks
-	if (FMath::Abs(PC->GetInputAnalogKeyState(EKeys::Gamepad_LeftX)) > 0.1f ||
-		FMath::Abs(PC->GetInputAnalogKeyState(EKeys::Gamepad_LeftY)) > 0.1f ||
-		FMath::Abs(PC->GetInputAnalogKeyState(EKeys::Gamepad_RightX)) > 0.1f ||
-		FMath::Abs(PC->GetInputAnalogKeyState(EKeys::Gamepad_RightY)) > 0.1f)
+void UInteractableWidget::HandleInputDeviceChanged(EInteractionInputDevice NewDevice)
+{
+	bIsUsingGamepad = NewDevice == EInteractionInputDevice::IID_Gamepad;
+
+	// Same action, other device's key
+	if (CurrentInputAction)
 	{
-		return true;
+		CurrentInputKey = GetBoundKeyForInputAction(CurrentInputAction);
 	}
 
-	// Check common gamepad buttons (face buttons, shoulders)
-	static const TArray<FKey> GamepadKeys = {
-		EKeys::Gamepad_FaceButton_Bottom,
-		EKeys::Gamepad_FaceButton_Right,
-		EKeys::Gamepad_FaceButton_Left,
-		EKeys::Gamepad_FaceButton_Top,
-		EKeys::Gamepad_LeftShoulder,
-		EKeys::Gamepad_RightShoulder,
-		EKeys::Gamepad_LeftTrigger,
-		EKeys::Gamepad_RightTrigger
-	};
-
-	for (const FKey& Key : GamepadKeys)
+	RefreshInputMode();
+
+	UE_LOG(LogInteractableWidget, Verbose, TEXT("Input mode changed to: %s"),
+		bIsUsingGamepad ? TEXT("Gamepad") : TEXT("Keyboard"));
+}
+
+void UInteractableWidget::HandleKeyBindingsChanged()
+{
+	if (CurrentInputAction)
 	{
-		if (PC->IsInputKeyDown(Key))
-		{
-			return true;
-		}
+		CurrentInputKey = GetBoundKeyForInputAction(CurrentInputAction);
+		UpdateKeyIcon();
 	}
-
-	return false;
 }
 
 // ═══════════════════════════════════════════════════════════════════════
@@ -494,82 +487,28 @@ FKey UInteractableWidget::GetBoundKeyForInputAction(UInputAction* InputAction) c
 		return EKeys::Invalid;
 	}
 
-	UEnhancedInputLocalPlayerSubsystem* Subsystem = GetEnhancedInputSubsystem();
-	if (!Subsystem)
+	// OPTIMIZATION: Cached per-action lookup instead of copying every player mapping per call
+	const UInteractionInputSubsystem* Input = InputSubsystem.Get();
+	if (!Input)
 	{
-		UE_LOG(LogInteractableWidget, Warning, TEXT("GetBoundKeyForInputAction: Cannot get Enhanced Input Subsystem!"));
+		UE_LOG(LogInteractableWidget, Warning, TEXT("GetBoundKeyForInputAction: Cannot get Interaction Input Subsystem!"));
 		return EKeys::Invalid;
 	}
 
-	// ═══════════════════════════════════════════════
-	// QUERY ALL ACTIVE MAPPING CONTEXTS
-	// ═══════════════════════════════════════════════
-	TArray<FKey> BoundKeys;
-	
-	// Get all active mapping contexts
-	TArray<FEnhancedActionKeyMapping> Mappings = Subsystem->GetAllPlayerMappableActionKeyMappings();
-	
-	for (const FEnhancedActionKeyMapping& Mapping : Mappings)
-	{
-		if (Mapping.Action == InputAction)
-		{
-			// Found a binding for this action
-			FKey MappedKey = Mapping.Key;
-			
-			// ═══════════════════════════════════════════════
-			// FILTER BY INPUT MODE
-			// ═══════════════════════════════════════════════
-			bool bIsGamepadKey = MappedKey.IsGamepadKey();
-			
-			// If current mode matches this key type, use it
-			if (bIsUsingGamepad == bIsGamepadKey)
-			{
-				UE_LOG(LogInteractableWidget, Verbose, TEXT("Found bound key '%s' for InputAction '%s' (Mode: %s)"),
-					*MappedKey.ToString(),
-					*InputAction->GetName(),
-					bIsUsingGamepad ? TEXT("Gamepad") : TEXT("Keyboard"));
-				
-				return MappedKey;
-			}
-			
-			// Store for fallback
-			BoundKeys.Add(MappedKey);
-		}
-	}
-
-	// ═══════════════════════════════════════════════
-	// FALLBACK: Return first found key (wrong mode is better than nothing)
-	// ═══════════════════════════════════════════════
-	if (BoundKeys.Num() > 0)
-	{
-		UE_LOG(LogInteractableWidget, Verbose, TEXT("Using fallback key '%s' for InputAction '%s' (mode mismatch)"),
-			*BoundKeys[0].ToString(),
-			*InputAction->GetName());
-		return BoundKeys[0];
-	}
-
-	// ═══════════════════════════════════════════════
-	// NO BINDING FOUND
-	// ═══════════════════════════════════════════════
-	UE_LOG(LogInteractableWidget, Warning, TEXT("No key binding found for InputAction '%s'!"),
-		*InputAction->GetName());
-	
-	return EKeys::Invalid;
+	return Input->GetKeyForAction(InputAction);
 }
 
-UEnhancedInputLocalPlayerSubsystem* UInteractableWidget::GetEnhancedInputSubsystem() const
+UInteractionInputSubsystem* UInteractableWidget::GetInteractionInputSubsystem() const
 {
-	APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0);
-	if (!PC)
-	{
-		return nullptr;
-	}
-
-	ULocalPlayer* LocalPlayer = PC->GetLocalPlayer();
+	// World-space widgets usually have no owning player - use the first local one
+	ULocalPlayer* LocalPlayer = GetOwningLocalPlayer();
 	if (!LocalPlayer)
 	{
-		return nullptr;
+		if (APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0))
+		{
+			LocalPlayer = PC->GetLocalPlayer();
+		}
 	}
 
-	return LocalPlayer->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>();
-}
\ No newline at end of file
+	return LocalPlayer ? LocalPlayer->GetSubsystem<UInteractionInputSubsystem>() : nullptr;
+}
@@ -2,6 +2,8 @@
 
 #include "Item/ItemInstance.h"
 #include "Item/Generation/AffixGenerator.h"
+#include "Item/Serialization/ItemCompactSerializer.h"
+#include "Character/Component/ConsumableCooldownManager.h"
 #include "AbilitySystemComponent.h"
 
 UItemInstance::UItemInstance()
@@ -103,6 +105,7 @@ void UItemInstance::InitializeWithCorruption(
 				}
 			}
 			
+			Stats.SourceBaseItem = BaseItemHandle;
 			bIdentified = !(Base->bCanBeIdentified);
 			break;
 		}
@@ -536,7 +539,7 @@ void UItemInstance::RemoveAffixesFromCharacter(UAbilitySystemComponent* ASC)
 
 bool UItemInstance::UseConsumable(AActor* Target)
 {
-	if (!CanUseConsumable() || !Target)
+	if (!Target || !CanUseConsumableForUser(Target))
 	{
 		return false;
 	}
@@ -553,9 +556,12 @@ bool UItemInstance::UseConsumable(AActor* Target)
 		return false;
 	}
 	
-	// Start cooldown
-	CooldownRemaining = Base->ConsumableData.Cooldown;
-	LastUseTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+	// Start cooldown (timestamp on the user - nothing ticks per item)
+	if (UConsumableCooldownManager* CooldownManager = Target->FindComponentByClass<UConsumableCooldownManager>())
+	{
+		CooldownManager->StartItemCooldown(this);
+	}
+	LastUseTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
 	
 	// Reduce uses or quantity
 	if (Base->ConsumableData.MaxUses > 1)
@@ -571,19 +577,32 @@ bool UItemInstance::UseConsumable(AActor* Target)
 }
 
 bool UItemInstance::CanUseConsumable() const
+{
+	return CanUseConsumableForUser(nullptr);
+}
+
+bool UItemInstance::CanUseConsumableForUser(const AActor* User) const
 {
 	if (!IsConsumable())
 	{
 		return false;
 	}
 	
-	if (CooldownRemaining > 0.0f)
+	FItemBase* Base = GetBaseData();
+	if (!Base)
 	{
 		return false;
 	}
 	
-	FItemBase* Base = GetBaseData();
-	if (!Base)
+	// Never skip the cooldown: user's manager, owner's manager, then this item's own timestamp
+	if (const UConsumableCooldownManager* CooldownManager = FindCooldownManager(User))
+	{
+		if (CooldownManager->IsItemOnCooldown(this))
+		{
+			return false;
+		}
+	}
+	else if (GetLocalCooldownProgress() < 1.0f)
 	{
 		return false;
 	}
@@ -602,6 +621,11 @@ bool UItemInstance::CanUseConsumable() const
 }
 
 float UItemInstance::GetCooldownProgress() const
+{
+	return GetCooldownProgressForUser(nullptr);
+}
+
+float UItemInstance::GetCooldownProgressForUser(const AActor* User) const
 {
 	FItemBase* Base = GetBaseData();
 	if (!Base || Base->ConsumableData.Cooldown <= 0.0f)
@@ -609,7 +633,36 @@ float UItemInstance::GetCooldownProgress() const
 		return 1.0f;
 	}
 	
-	return FMath::Clamp(1.0f - (CooldownRemaining / Base->ConsumableData.Cooldown), 0.0f, 1.0f);
+	const UConsumableCooldownManager* CooldownManager = FindCooldownManager(User);
+	return CooldownManager ? CooldownManager->GetItemCooldownProgress(this) : GetLocalCooldownProgress();
+}
+
+const UConsumableCooldownManager* UItemInstance::FindCooldownManager(const AActor* User) const
+{
+	if (User)
+	{
+		if (const UConsumableCooldownManager* CooldownManager = User->FindComponentByClass<UConsumableCooldownManager>())
+		{
+			return CooldownManager;
+		}
+	}
+	
+	// Items live under their inventory component, so the outer chain reaches the character
+	const AActor* Owner = GetTypedOuter<AActor>();
+	return (Owner && Owner != User) ? Owner->FindComponentByClass<UConsumableCooldownManager>() : nullptr;
+}
+
+float UItemInstance::GetLocalCooldownProgress() const
+{
+	const FItemBase* Base = GetBaseData();
+	const UWorld* World = GetWorld();
+	if (!Base || Base->ConsumableData.Cooldown <= 0.0f || !World || LastUseTime <= 0.0)
+	{
+		return 1.0f;
+	}
+	
+	const double Elapsed = World->GetTimeSeconds() - LastUseTime;
+	return FMath::Clamp(static_cast<float>(Elapsed / Base->ConsumableData.Cooldown), 0.0f, 1.0f);
 }
 
 bool UItemInstance::ReduceUses(int32 Amount)
@@ -625,14 +678,6 @@ bool UItemInstance::ApplyConsumableEffects(AActor* Target)
 	return true;
 }
 
-void UItemInstance::UpdateCooldown(float DeltaTime)
-{
-	if (CooldownRemaining > 0.0f)
-	{
-		CooldownRemaining = FMath::Max(0.0f, CooldownRemaining - DeltaTime);
-	}
-}
-
 // ═══════════════════════════════════════════════
 // IDENTIFICATION (Equipment)
 // ═══════════════════════════════════════════════
@@ -974,6 +1019,7 @@ void UItemInstance::PostLoadInitialize()
 {
 	bCacheDirty = true;
 	InvalidateBaseCache();
+	Stats.SourceBaseItem = BaseItemHandle;
 	
 	if (!HasValidBaseData())
 	{
@@ -983,4 +1029,10 @@ void UItemInstance::PostLoadInitialize()
 	
 	// Recalculate corruption state after load
 	CalculateCorruptionState();
-}
\ No newline at end of file
+}
+
+bool UItemInstance::SerializeCompact(FArchive& Ar)
+{
+	FItemCompactSerializer Serializer;
+	return Serializer.SerializeStandalone(Ar, this);
+}
@@ -2,3 +2,41 @@
 
 #include "Item/Library/ItemStructs.h"
 #include "Item/Library/ItemFunctionLibrary.h"
+#include "Item/Serialization/ItemCompactSerializer.h"
+#include "UObject/CoreNet.h"
+
+// ═══════════════════════════════════════════════════════════════════════
+// ITEM STATS - NET SERIALIZATION
+// ═══════════════════════════════════════════════════════════════════════
+
+bool FPHItemStats::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	// Base row first, so implicit/unique affixes go out as template positions instead of full structs
+	uint8 bHasBase = (Ar.IsSaving() && Map && !SourceBaseItem.IsNull()) ? 1 : 0;
+	Ar.SerializeBits(&bHasBase, 1);
+
+	const FItemBase* Base = nullptr;
+	if (bHasBase)
+	{
+		if (!Map)
+		{
+			Ar.SetError();
+			bOutSuccess = false;
+			return true;
+		}
+
+		UObject* TableObject = const_cast<UDataTable*>(SourceBaseItem.DataTable.Get());
+		Map->SerializeObject(Ar, UDataTable::StaticClass(), TableObject);
+		Map->SerializeName(Ar, SourceBaseItem.RowName);
+
+		if (Ar.IsLoading())
+		{
+			SourceBaseItem.DataTable = Cast<UDataTable>(TableObject);
+		}
+
+		Base = SourceBaseItem.GetRow<FItemBase>(TEXT("FPHItemStats::NetSerialize"));
+	}
+
+	bOutSuccess = FItemCompactSerializer::Get().SerializeStats(Ar, *this, Base, Map);
+	return true;
+}
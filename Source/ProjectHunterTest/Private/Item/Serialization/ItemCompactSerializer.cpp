@@ -0,0 +1,1036 @@
+// Item/Serialization/ItemCompactSerializer.cpp
+
+#include "Item/Serialization/ItemCompactSerializer.h"
+#include "Item/ItemInstance.h"
+#include "Item/Generation/AffixGenerator.h"
+#include "Engine/DataTable.h"
+#include "UObject/CoreNet.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "UObject/Package.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY(LogItemSerialization);
+
+namespace ItemCompactSerialization
+{
+	/** 'PHIS' - Project Hunter Item Stash */
+	constexpr uint32 Magic = 0x50484953;
+
+	// Per-item state flags
+	constexpr uint16 Flag_Identified        = 1 << 0;
+	constexpr uint16 Flag_CanBeModified     = 1 << 1;
+	constexpr uint16 Flag_Tradeable         = 1 << 2;
+	constexpr uint16 Flag_Soulbound         = 1 << 3;
+	constexpr uint16 Flag_KeyItem           = 1 << 4;
+	constexpr uint16 Flag_HasStats          = 1 << 5;
+	constexpr uint16 Flag_CustomMaxDur      = 1 << 6;
+	constexpr uint16 Flag_HasRunes          = 1 << 7;
+	constexpr uint16 Flag_HasQuestID        = 1 << 8;
+	constexpr uint16 Flag_HasValueModifier  = 1 << 9;
+
+	// Per-affix flags (low 2 bits = EAffixTemplateSource)
+	constexpr uint8 AffixSourceMask         = 0x03;
+	constexpr uint8 AffixFlag_Identified    = 1 << 2;
+	constexpr uint8 AffixFlag_FixedValue    = 1 << 3;
+	constexpr uint8 AffixFlag_Unquantized   = 1 << 4;
+}
+
+FItemCompactSerializer::FItemCompactSerializer()
+{
+}
+
+FItemCompactSerializer& FItemCompactSerializer::Get()
+{
+	static FItemCompactSerializer SharedSerializer;
+	return SharedSerializer;
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// BLOB API
+// ═══════════════════════════════════════════════════════════════════════
+
+bool FItemCompactSerializer::SerializeItems(FArchive& Ar, TArray<UItemInstance*>& Items, UObject* Outer, TArray<int32>* OutWrittenIndices)
+{
+	using namespace ItemCompactSerialization;
+
+	ResetTables();
+
+	if (Ar.IsSaving())
+	{
+		// Pass 1: write item payloads into a body buffer while building name tables
+		TArray<uint8> Body;
+		FMemoryWriter BodyWriter(Body);
+		bUseNameTables = true;
+
+		if (OutWrittenIndices)
+		{
+			OutWrittenIndices->Reset();
+		}
+
+		uint32 ItemCount = 0;
+		for (int32 ItemIndex = 0; ItemIndex < Items.Num(); ++ItemIndex)
+		{
+			UItemInstance* Item = Items[ItemIndex];
+			if (!Item)
+			{
+				continue;
+			}
+
+			// A rejected item may have written part of its payload - roll the body back
+			const int64 ItemStart = BodyWriter.Tell();
+			if (SerializeItemPayload(BodyWriter, Item))
+			{
+				ItemCount++;
+				if (OutWrittenIndices)
+				{
+					OutWrittenIndices->Add(ItemIndex);
+				}
+			}
+			else
+			{
+				Body.SetNum(static_cast<int32>(ItemStart));
+				BodyWriter.Seek(ItemStart);
+			}
+		}
+
+		// Pass 2: header + name tables + body
+		uint32 MagicValue = Magic;
+		uint8 VersionValue = static_cast<uint8>(EItemCompactVersion::Latest);
+		Ar << MagicValue;
+		Ar << VersionValue;
+
+		uint32 NumTables = BaseTables.Num();
+		Ar.SerializeIntPacked(NumTables);
+		for (UDataTable* Table : BaseTables)
+		{
+			FString TablePath = FSoftObjectPath(Table).ToString();
+			Ar << TablePath;
+		}
+
+		uint32 NumRows = BaseRows.Num();
+		Ar.SerializeIntPacked(NumRows);
+		for (FBaseRowEntry& Row : BaseRows)
+		{
+			uint32 TableIndex = Row.TableIndex;
+			FString RowName = Row.RowName.ToString();
+			Ar.SerializeIntPacked(TableIndex);
+			Ar << RowName;
+		}
+
+		uint32 NumTemplates = AffixTemplates.Num();
+		Ar.SerializeIntPacked(NumTemplates);
+		for (FAffixTemplateEntry& Template : AffixTemplates)
+		{
+			uint8 Source = static_cast<uint8>(Template.Source);
+			FString AttributeName = Template.AttributeName.ToString();
+			Ar << Source;
+			Ar << AttributeName;
+		}
+
+		Ar.SerializeIntPacked(ItemCount);
+		Ar.Serialize(Body.GetData(), Body.Num());
+
+		bUseNameTables = false;
+		return !Ar.IsError();
+	}
+
+	// ═══════════════════════════════════════════════
+	// LOADING
+	// ═══════════════════════════════════════════════
+
+	int32 ItemCount = 0;
+	if (!BeginReadItems(Ar, ItemCount))
+	{
+		return false;
+	}
+
+	Items.Reset();
+	Items.Reserve(ItemCount);
+
+	bool bSuccess = true;
+	for (int32 i = 0; i < ItemCount; ++i)
+	{
+		UItemInstance* Item = ReadNextItem(Ar, Outer);
+		if (!Item)
+		{
+			UE_LOG(LogItemSerialization, Error, TEXT("SerializeItems: Failed to read item %d/%d"), i, ItemCount);
+			bSuccess = false;
+			break;
+		}
+		Items.Add(Item);
+	}
+
+	EndReadItems();
+	return bSuccess;
+}
+
+bool FItemCompactSerializer::BeginReadItems(FArchive& Ar, int32& OutItemCount)
+{
+	using namespace ItemCompactSerialization;
+
+	check(Ar.IsLoading());
+
+	ResetTables();
+	OutItemCount = 0;
+
+	uint32 MagicValue = 0;
+	uint8 VersionValue = 0;
+	Ar << MagicValue;
+	Ar << VersionValue;
+
+	if (MagicValue != Magic)
+	{
+		UE_LOG(LogItemSerialization, Error, TEXT("SerializeItems: Bad magic 0x%08x"), MagicValue);
+		return false;
+	}
+
+	if (VersionValue == 0 || VersionValue > static_cast<uint8>(EItemCompactVersion::Latest))
+	{
+		UE_LOG(LogItemSerialization, Error, TEXT("SerializeItems: Unsupported version %d (latest %d)"),
+			VersionValue, static_cast<int32>(EItemCompactVersion::Latest));
+		return false;
+	}
+
+	ArchiveVersion = static_cast<EItemCompactVersion>(VersionValue);
+
+	// Every table entry and item takes at least one byte, so a count larger than what is left
+	// in the blob is corrupt - reject it before it drives a loop or an allocation
+	const int64 TotalSize = Ar.TotalSize();
+	if (TotalSize < 0)
+	{
+		UE_LOG(LogItemSerialization, Error, TEXT("SerializeItems: Archive has no known size, counts cannot be validated"));
+		return false;
+	}
+
+	auto IsCountInRange = [&Ar, TotalSize](uint32 Count, const TCHAR* What)
+	{
+		const int64 Remaining = TotalSize - Ar.Tell();
+		if (Ar.IsError() || Count > static_cast<uint32>(MAX_int32) || static_cast<int64>(Count) > Remaining)
+		{
+			UE_LOG(LogItemSerialization, Error, TEXT("SerializeItems: Corrupt header (%u %s with %lld bytes left)"),
+				Count, What, Remaining);
+			Ar.SetError();
+			return false;
+		}
+		return true;
+	};
+
+	uint32 NumTables = 0;
+	Ar.SerializeIntPacked(NumTables);
+	if (!IsCountInRange(NumTables, TEXT("base tables")))
+	{
+		return false;
+	}
+
+	for (uint32 i = 0; i < NumTables && !Ar.IsError(); ++i)
+	{
+		FString TablePath;
+		Ar << TablePath;
+
+		UDataTable* Table = Cast<UDataTable>(FSoftObjectPath(TablePath).TryLoad());
+		if (!Table)
+		{
+			UE_LOG(LogItemSerialization, Warning, TEXT("SerializeItems: Base table '%s' no longer exists"), *TablePath);
+		}
+		BaseTables.Add(Table);
+	}
+
+	uint32 NumRows = 0;
+	Ar.SerializeIntPacked(NumRows);
+	if (!IsCountInRange(NumRows, TEXT("base rows")))
+	{
+		return false;
+	}
+
+	for (uint32 i = 0; i < NumRows && !Ar.IsError(); ++i)
+	{
+		uint32 TableIndex = 0;
+		FString RowName;
+		Ar.SerializeIntPacked(TableIndex);
+		Ar << RowName;
+
+		FBaseRowEntry& Row = BaseRows.AddDefaulted_GetRef();
+		Row.TableIndex = static_cast<int32>(TableIndex);
+		Row.RowName = FName(*RowName);
+	}
+
+	uint32 NumTemplates = 0;
+	Ar.SerializeIntPacked(NumTemplates);
+	if (!IsCountInRange(NumTemplates, TEXT("affix templates")))
+	{
+		return false;
+	}
+
+	for (uint32 i = 0; i < NumTemplates && !Ar.IsError(); ++i)
+	{
+		uint8 Source = 0;
+		FString AttributeName;
+		Ar << Source;
+		Ar << AttributeName;
+
+		FAffixTemplateEntry& Template = AffixTemplates.AddDefaulted_GetRef();
+		Template.Source = static_cast<EAffixTemplateSource>(Source & AffixSourceMask);
+		Template.AttributeName = FName(*AttributeName);
+	}
+
+	uint32 ItemCount = 0;
+	Ar.SerializeIntPacked(ItemCount);
+	if (!IsCountInRange(ItemCount, TEXT("items")))
+	{
+		return false;
+	}
+
+	OutItemCount = static_cast<int32>(ItemCount);
+	bUseNameTables = true;
+	return true;
+}
+
+UItemInstance* FItemCompactSerializer::ReadNextItem(FArchive& Ar, UObject* Outer)
+{
+	UItemInstance* Item = NewObject<UItemInstance>(Outer ? Outer : GetTransientPackage());
+	if (!SerializeItemPayload(Ar, Item) || Ar.IsError())
+	{
+		return nullptr;
+	}
+
+	return Item;
+}
+
+void FItemCompactSerializer::EndReadItems()
+{
+	bUseNameTables = false;
+}
+
+bool FItemCompactSerializer::SaveItemsToBytes(const TArray<UItemInstance*>& Items, TArray<uint8>& OutBytes)
+{
+	OutBytes.Reset();
+	FMemoryWriter Writer(OutBytes);
+	TArray<UItemInstance*> ItemsCopy = Items;
+	return SerializeItems(Writer, ItemsCopy);
+}
+
+bool FItemCompactSerializer::LoadItemsFromBytes(const TArray<uint8>& Bytes, TArray<UItemInstance*>& OutItems, UObject* Outer)
+{
+	FMemoryReader Reader(Bytes);
+	return SerializeItems(Reader, OutItems, Outer);
+}
+
+bool FItemCompactSerializer::SerializeStandalone(FArchive& Ar, UItemInstance* Item)
+{
+	uint8 VersionValue = static_cast<uint8>(EItemCompactVersion::Latest);
+	Ar << VersionValue;
+
+	if (Ar.IsLoading() && (VersionValue == 0 || VersionValue > static_cast<uint8>(EItemCompactVersion::Latest)))
+	{
+		UE_LOG(LogItemSerialization, Error, TEXT("SerializeStandalone: Unsupported version %d"), VersionValue);
+		return false;
+	}
+
+	ArchiveVersion = static_cast<EItemCompactVersion>(VersionValue);
+	bUseNameTables = false;
+	return SerializeItemPayload(Ar, Item);
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// PER-ITEM PAYLOAD
+// ═══════════════════════════════════════════════════════════════════════
+
+bool FItemCompactSerializer::SerializeItemPayload(FArchive& Ar, UItemInstance* Item)
+{
+	using namespace ItemCompactSerialization;
+
+	if (!Item)
+	{
+		return false;
+	}
+
+	// ═══════════════════════════════════════════════
+	// BASE ITEM
+	// ═══════════════════════════════════════════════
+
+	if (bUseNameTables)
+	{
+		uint32 BaseIndex = 0;
+		if (Ar.IsSaving())
+		{
+			const int32 Index = GetOrAddBaseRow(Item->BaseItemHandle);
+			if (Index == INDEX_NONE)
+			{
+				UE_LOG(LogItemSerialization, Warning, TEXT("SerializeItemPayload: Item %s has no base handle, skipped"),
+					*Item->UniqueID.ToString());
+				return false;
+			}
+			BaseIndex = Index;
+		}
+
+		Ar.SerializeIntPacked(BaseIndex);
+
+		if (Ar.IsLoading())
+		{
+			if (!BaseRows.IsValidIndex(BaseIndex))
+			{
+				return false;
+			}
+
+			const FBaseRowEntry& Row = BaseRows[BaseIndex];
+			Item->BaseItemHandle.DataTable = BaseTables.IsValidIndex(Row.TableIndex) ? BaseTables[Row.TableIndex] : nullptr;
+			Item->BaseItemHandle.RowName = Row.RowName;
+		}
+	}
+	else
+	{
+		// Standalone: self-describing handle
+		FString TablePath = Ar.IsSaving() ? FSoftObjectPath(Item->BaseItemHandle.DataTable).ToString() : FString();
+		FString RowName = Ar.IsSaving() ? Item->BaseItemHandle.RowName.ToString() : FString();
+		Ar << TablePath;
+		Ar << RowName;
+
+		if (Ar.IsLoading())
+		{
+			Item->BaseItemHandle.DataTable = Cast<UDataTable>(FSoftObjectPath(TablePath).TryLoad());
+			Item->BaseItemHandle.RowName = FName(*RowName);
+		}
+	}
+
+	if (Ar.IsLoading())
+	{
+		Item->InvalidateBaseCache();
+	}
+
+	const FItemBase* Base = Item->GetBaseData();
+
+	// ═══════════════════════════════════════════════
+	// IDENTITY & ROLL INPUTS
+	// ═══════════════════════════════════════════════
+
+	Ar << Item->UniqueID;
+	Ar << Item->Seed;
+
+	if (Ar.IsSaving() && Item->ItemLevel < 0)
+	{
+		UE_LOG(LogItemSerialization, Warning, TEXT("SerializeItemPayload: Item %s has negative level %d, skipped"),
+			*Item->UniqueID.ToString(), Item->ItemLevel);
+		return false;
+	}
+
+	uint32 Level = static_cast<uint32>(FMath::Max(0, Item->ItemLevel));
+	if (ArchiveVersion >= EItemCompactVersion::PackedItemLevel)
+	{
+		Ar.SerializeIntPacked(Level);
+	}
+	else
+	{
+		uint8 LegacyLevel = static_cast<uint8>(Level);
+		Ar << LegacyLevel;
+		Level = LegacyLevel;
+	}
+
+	uint8 RarityValue = static_cast<uint8>(Item->Rarity);
+	Ar << RarityValue;
+
+	if (Ar.IsLoading() && RarityValue > static_cast<uint8>(EItemRarity::IR_Corrupted))
+	{
+		UE_LOG(LogItemSerialization, Error, TEXT("SerializeItemPayload: Item %s has invalid rarity %d"),
+			*Item->UniqueID.ToString(), RarityValue);
+		Ar.SetError();
+		return false;
+	}
+
+	uint32 Quantity = static_cast<uint32>(FMath::Max(0, Item->Quantity));
+	uint32 Uses = static_cast<uint32>(FMath::Max(0, Item->RemainingUses));
+	Ar.SerializeIntPacked(Quantity);
+	Ar.SerializeIntPacked(Uses);
+
+	// ═══════════════════════════════════════════════
+	// STATE FLAGS
+	// ═══════════════════════════════════════════════
+
+	const float BaseMaxDurability = Base ? Base->MaxDurability : 100.0f;
+
+	uint16 Flags = 0;
+	if (Ar.IsSaving())
+	{
+		if (Item->bIdentified)                  Flags |= Flag_Identified;
+		if (Item->bCanBeModified)               Flags |= Flag_CanBeModified;
+		if (Item->bIsTradeable)                 Flags |= Flag_Tradeable;
+		if (Item->bIsSoulbound)                 Flags |= Flag_Soulbound;
+		if (Item->bIsKeyItem)                   Flags |= Flag_KeyItem;
+		if (!Item->Stats.IsEmpty() || Item->Stats.bAffixesGenerated) Flags |= Flag_HasStats;
+		if (!FMath::IsNearlyEqual(Item->Durability.MaxDurability, BaseMaxDurability)) Flags |= Flag_CustomMaxDur;
+		if (Item->RuneCraftingData.GetSocketCount() > 0 || Item->RuneCraftingData.EnhancementLevel > 0) Flags |= Flag_HasRunes;
+		if (!Item->QuestID.IsNone())            Flags |= Flag_HasQuestID;
+		if (Item->ValueModifier != 0.0f)        Flags |= Flag_HasValueModifier;
+	}
+	Ar << Flags;
+
+	// ═══════════════════════════════════════════════
+	// DURABILITY (Quantized relative to max)
+	// ═══════════════════════════════════════════════
+
+	if (Flags & Flag_CustomMaxDur)
+	{
+		Ar << Item->Durability.MaxDurability;
+	}
+	else if (Ar.IsLoading())
+	{
+		Item->Durability.MaxDurability = BaseMaxDurability;
+	}
+
+	uint16 DurabilityQ = Ar.IsSaving() ? QuantizeUnit(Item->Durability.GetDurabilityPercent()) : 0;
+	Ar << DurabilityQ;
+
+	// ═══════════════════════════════════════════════
+	// RARE FIELDS
+	// ═══════════════════════════════════════════════
+
+	if (Flags & Flag_HasRunes)
+	{
+		FRuneCraftingData::StaticStruct()->SerializeBin(Ar, &Item->RuneCraftingData);
+	}
+
+	if (Flags & Flag_HasQuestID)
+	{
+		FString QuestName = Ar.IsSaving() ? Item->QuestID.ToString() : FString();
+		Ar << QuestName;
+		if (Ar.IsLoading())
+		{
+			Item->QuestID = FName(*QuestName);
+		}
+	}
+
+	if (Flags & Flag_HasValueModifier)
+	{
+		Ar << Item->ValueModifier;
+	}
+
+	// ═══════════════════════════════════════════════
+	// STATS
+	// ═══════════════════════════════════════════════
+
+	if (Flags & Flag_HasStats)
+	{
+		if (!SerializeStats(Ar, Item->Stats, Base))
+		{
+			return false;
+		}
+	}
+
+	// ═══════════════════════════════════════════════
+	// POST-LOAD (Rebuild derived state)
+	// ═══════════════════════════════════════════════
+
+	if (Ar.IsLoading())
+	{
+		Item->ItemLevel = static_cast<int32>(Level);
+		Item->LastUseTime = 0.0;
+		Item->Rarity = static_cast<EItemRarity>(RarityValue);
+		Item->Quantity = static_cast<int32>(Quantity);
+		Item->RemainingUses = static_cast<int32>(Uses);
+
+		Item->bIdentified = (Flags & Flag_Identified) != 0;
+		Item->bCanBeModified = (Flags & Flag_CanBeModified) != 0;
+		Item->bIsTradeable = (Flags & Flag_Tradeable) != 0;
+		Item->bIsSoulbound = (Flags & Flag_Soulbound) != 0;
+		Item->bIsKeyItem = (Flags & Flag_KeyItem) != 0;
+
+		Item->Durability.CurrentDurability = Item->Durability.MaxDurability * DequantizeUnit(DurabilityQ);
+
+		Item->bHasNameBeenGenerated = false;
+		Item->PostLoadInitialize();
+		Item->UpdateTotalWeight();
+	}
+
+	return !Ar.IsError();
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// STATS
+// ═══════════════════════════════════════════════════════════════════════
+
+bool FItemCompactSerializer::SerializeStats(FArchive& Ar, FPHItemStats& Stats, const FItemBase* Base, UPackageMap* Map)
+{
+	// Unique items store their fixed affixes in Prefixes (see FAffixGenerator::GenerateAffixes)
+	const TArray<FPHAttributeData>* ImplicitList = Base ? &Base->ImplicitMods : nullptr;
+	const TArray<FPHAttributeData>* UniqueList = (Base && Base->UniqueAffixes.Num() > 0) ? &Base->UniqueAffixes : nullptr;
+
+	uint8 bGenerated = Stats.bAffixesGenerated ? 1 : 0;
+	Ar << bGenerated;
+	Stats.bAffixesGenerated = bGenerated != 0;
+
+	return SerializeAffixList(Ar, Stats.Implicits, ImplicitList, Map)
+		&& SerializeAffixList(Ar, Stats.Prefixes, UniqueList, Map)
+		&& SerializeAffixList(Ar, Stats.Suffixes, nullptr, Map)
+		&& SerializeAffixList(Ar, Stats.Crafted, nullptr, Map);
+}
+
+bool FItemCompactSerializer::SerializeAffixList(
+	FArchive& Ar,
+	TArray<FPHAttributeData>& Affixes,
+	const TArray<FPHAttributeData>* BaseList,
+	UPackageMap* Map)
+{
+	uint32 Count = Affixes.Num();
+	Ar.SerializeIntPacked(Count);
+
+	if (Ar.IsLoading())
+	{
+		// Items never carry more than a handful of affixes - reject garbage counts
+		if (Count > 64)
+		{
+			Ar.SetError();
+			return false;
+		}
+		Affixes.SetNum(Count);
+	}
+
+	for (uint32 i = 0; i < Count; ++i)
+	{
+		if (!SerializeAffix(Ar, Affixes[i], BaseList, i, Map))
+		{
+			return false;
+		}
+	}
+
+	return !Ar.IsError();
+}
+
+bool FItemCompactSerializer::SerializeAffix(
+	FArchive& Ar,
+	FPHAttributeData& Affix,
+	const TArray<FPHAttributeData>* BaseList,
+	int32 Position,
+	UPackageMap* Map)
+{
+	using namespace ItemCompactSerialization;
+
+	uint8 Flags = 0;
+	const FPHAttributeData* Template = nullptr;
+	EAffixTemplateSource Source = EAffixTemplateSource::Raw;
+
+	if (Ar.IsSaving())
+	{
+		Template = ResolveTemplate(Affix, BaseList, Position, Source);
+
+		Flags = static_cast<uint8>(Source);
+		if (Affix.bIsIdentified)
+		{
+			Flags |= AffixFlag_Identified;
+		}
+
+		if (Template)
+		{
+			const float Range = Template->MaxValue - Template->MinValue;
+			if (FMath::IsNearlyZero(Range) && FMath::IsNearlyEqual(Affix.RolledStatValue, Template->MinValue))
+			{
+				Flags |= AffixFlag_FixedValue;
+			}
+			else if (Affix.RolledStatValue < Template->MinValue || Affix.RolledStatValue > Template->MaxValue || FMath::IsNearlyZero(Range))
+			{
+				// Value was modified outside the template range (crafting, etc.) - keep it exact
+				Flags |= AffixFlag_Unquantized;
+			}
+		}
+	}
+
+	Ar << Flags;
+	Source = static_cast<EAffixTemplateSource>(Flags & AffixSourceMask);
+
+	// ═══════════════════════════════════════════════
+	// RAW (No template) - full struct
+	// ═══════════════════════════════════════════════
+
+	if (Source == EAffixTemplateSource::Raw)
+	{
+		if (Map)
+		{
+			FPHAttributeData::StaticStruct()->SerializeBin(Ar, &Affix);
+		}
+		else
+		{
+			FObjectAndNameAsStringProxyArchive Proxy(Ar, true);
+			FPHAttributeData::StaticStruct()->SerializeBin(Proxy, &Affix);
+		}
+		return !Ar.IsError();
+	}
+
+	// ═══════════════════════════════════════════════
+	// TEMPLATE KEY
+	// ═══════════════════════════════════════════════
+
+	if (Source != EAffixTemplateSource::BaseList)
+	{
+		FName AttributeName = Affix.AttributeName;
+		SerializeTemplateName(Ar, Source, AttributeName, Map);
+
+		if (Ar.IsLoading())
+		{
+			Template = FindTableTemplate(Source, AttributeName);
+		}
+	}
+	else if (Ar.IsLoading())
+	{
+		Template = (BaseList && BaseList->IsValidIndex(Position)) ? &(*BaseList)[Position] : nullptr;
+	}
+
+	if (Ar.IsLoading() && !Template)
+	{
+		UE_LOG(LogItemSerialization, Error, TEXT("SerializeAffix: Template for affix %d (source %d) no longer exists"),
+			Position, static_cast<int32>(Source));
+		Ar.SetError();
+		return false;
+	}
+
+	// ═══════════════════════════════════════════════
+	// ROLLED VALUE
+	// ═══════════════════════════════════════════════
+
+	float RolledValue = Affix.RolledStatValue;
+	if (Flags & AffixFlag_Unquantized)
+	{
+		Ar << RolledValue;
+	}
+	else if (!(Flags & AffixFlag_FixedValue))
+	{
+		const float Range = Template->MaxValue - Template->MinValue;
+		uint16 Quantized = Ar.IsSaving() ? QuantizeUnit((RolledValue - Template->MinValue) / Range) : 0;
+		Ar << Quantized;
+		RolledValue = Template->MinValue + DequantizeUnit(Quantized) * Range;
+	}
+	else
+	{
+		RolledValue = Template->MinValue;
+	}
+
+	if (Ar.IsLoading())
+	{
+		Affix = *Template;
+		Affix.RolledStatValue = RolledValue;
+		Affix.bIsIdentified = (Flags & AffixFlag_Identified) != 0;
+		Affix.GenerateUID();
+	}
+
+	return !Ar.IsError();
+}
+
+const FPHAttributeData* FItemCompactSerializer::ResolveTemplate(
+	const FPHAttributeData& Affix,
+	const TArray<FPHAttributeData>* BaseList,
+	int32 Position,
+	EAffixTemplateSource& OutSource) const
+{
+	// Base list templates are copied in order, so match by position
+	if (BaseList && BaseList->IsValidIndex(Position))
+	{
+		const FPHAttributeData& Candidate = (*BaseList)[Position];
+		if (Candidate.AttributeName == Affix.AttributeName && Candidate.AffixType == Affix.AffixType)
+		{
+			OutSource = EAffixTemplateSource::BaseList;
+			return &Candidate;
+		}
+	}
+
+	if (Affix.AttributeName.IsNone())
+	{
+		OutSource = EAffixTemplateSource::Raw;
+		return nullptr;
+	}
+
+	// Rolled affixes are keyed by AttributeName (same key the generator uses for exclusion)
+	const EAffixTemplateSource TableOrder[2] = {
+		Affix.IsSuffix() ? EAffixTemplateSource::SuffixTable : EAffixTemplateSource::PrefixTable,
+		Affix.IsSuffix() ? EAffixTemplateSource::PrefixTable : EAffixTemplateSource::SuffixTable
+	};
+
+	for (EAffixTemplateSource TableSource : TableOrder)
+	{
+		if (const FPHAttributeData* Candidate = FindTableTemplate(TableSource, Affix.AttributeName))
+		{
+			if (Candidate->AffixType == Affix.AffixType)
+			{
+				OutSource = TableSource;
+				return Candidate;
+			}
+		}
+	}
+
+	OutSource = EAffixTemplateSource::Raw;
+	return nullptr;
+}
+
+void FItemCompactSerializer::SerializeTemplateName(FArchive& Ar, EAffixTemplateSource Source, FName& Name, UPackageMap* Map)
+{
+	if (bUseNameTables)
+	{
+		uint32 Index = Ar.IsSaving() ? static_cast<uint32>(GetOrAddAffixTemplate(Source, Name)) : 0;
+		Ar.SerializeIntPacked(Index);
+
+		if (Ar.IsLoading())
+		{
+			if (AffixTemplates.IsValidIndex(Index))
+			{
+				Name = AffixTemplates[Index].AttributeName;
+			}
+			else
+			{
+				Ar.SetError();
+			}
+		}
+		return;
+	}
+
+	if (Map)
+	{
+		Map->SerializeName(Ar, Name);
+		return;
+	}
+
+	FString NameString = Ar.IsSaving() ? Name.ToString() : FString();
+	Ar << NameString;
+	if (Ar.IsLoading())
+	{
+		Name = FName(*NameString);
+	}
+}
+
+const FPHAttributeData* FItemCompactSerializer::FindTableTemplate(EAffixTemplateSource Source, FName AttributeName) const
+{
+	FTemplateTableCache* Cache = nullptr;
+	switch (Source)
+	{
+		case EAffixTemplateSource::PrefixTable: Cache = &PrefixTemplates; break;
+		case EAffixTemplateSource::SuffixTable: Cache = &SuffixTemplates; break;
+		default: return nullptr;
+	}
+
+	// Table unloaded/replaced (PIE restart, hot reload) - rebuild the name lookup
+	if (!Cache->bBuilt || !Cache->Table.IsValid())
+	{
+		BuildTemplateCache(Source, *Cache);
+	}
+
+	UDataTable* Table = Cache->Table.Get();
+	const FName* RowName = Cache->RowByAttribute.Find(AttributeName);
+	if (!Table || !RowName)
+	{
+		return nullptr;
+	}
+
+	// Resolve per use: row memory is reallocated whenever the table is reimported
+	const FPHAttributeData* Row = Table->FindRow<FPHAttributeData>(*RowName, TEXT("ItemCompactSerializer"), false);
+	if (!Row || Row->AttributeName != AttributeName)
+	{
+		// Rows were renamed or removed in place - rebuild once and retry
+		BuildTemplateCache(Source, *Cache);
+		RowName = Cache->RowByAttribute.Find(AttributeName);
+		Row = RowName ? Table->FindRow<FPHAttributeData>(*RowName, TEXT("ItemCompactSerializer"), false) : nullptr;
+	}
+
+	return Row;
+}
+
+void FItemCompactSerializer::BuildTemplateCache(EAffixTemplateSource Source, FTemplateTableCache& Cache) const
+{
+	Cache.bBuilt = true;
+	Cache.RowByAttribute.Reset();
+
+	FAffixGenerator Generator;
+	UDataTable* Table = Generator.GetAffixDataTable(
+		Source == EAffixTemplateSource::SuffixTable ? EAffixes::AF_Suffix : EAffixes::AF_Prefix);
+	Cache.Table = Table;
+
+	if (!Table || !Table->GetRowStruct() || !Table->GetRowStruct()->IsChildOf(FPHAttributeData::StaticStruct()))
+	{
+		return;
+	}
+
+	const TMap<FName, uint8*>& RowMap = Table->GetRowMap();
+	Cache.RowByAttribute.Reserve(RowMap.Num());
+
+	for (const TPair<FName, uint8*>& Pair : RowMap)
+	{
+		const FPHAttributeData* Row = reinterpret_cast<const FPHAttributeData*>(Pair.Value);
+		if (Row && !Row->AttributeName.IsNone())
+		{
+			Cache.RowByAttribute.Add(Row->AttributeName, Pair.Key);
+		}
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// NAME TABLES
+// ═══════════════════════════════════════════════════════════════════════
+
+int32 FItemCompactSerializer::GetOrAddBaseRow(const FDataTableRowHandle& Handle)
+{
+	if (Handle.IsNull())
+	{
+		return INDEX_NONE;
+	}
+
+	UDataTable* Table = const_cast<UDataTable*>(Handle.DataTable.Get());
+	const TPair<UDataTable*, FName> Key(Table, Handle.RowName);
+
+	if (const int32* Found = BaseRowLookup.Find(Key))
+	{
+		return *Found;
+	}
+
+	FBaseRowEntry Entry;
+	Entry.TableIndex = BaseTables.AddUnique(Table);
+	Entry.RowName = Handle.RowName;
+
+	const int32 NewIndex = BaseRows.Add(Entry);
+	BaseRowLookup.Add(Key, NewIndex);
+	return NewIndex;
+}
+
+int32 FItemCompactSerializer::GetOrAddAffixTemplate(EAffixTemplateSource Source, FName AttributeName)
+{
+	const TPair<uint8, FName> Key(static_cast<uint8>(Source), AttributeName);
+
+	if (const int32* Found = AffixTemplateLookup.Find(Key))
+	{
+		return *Found;
+	}
+
+	FAffixTemplateEntry Entry;
+	Entry.Source = Source;
+	Entry.AttributeName = AttributeName;
+
+	const int32 NewIndex = AffixTemplates.Add(Entry);
+	AffixTemplateLookup.Add(Key, NewIndex);
+	return NewIndex;
+}
+
+void FItemCompactSerializer::ResetTables()
+{
+	BaseTables.Reset();
+	BaseRows.Reset();
+	AffixTemplates.Reset();
+	BaseRowLookup.Reset();
+	AffixTemplateLookup.Reset();
+	ArchiveVersion = EItemCompactVersion::Latest;
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// BENCHMARK (Compact vs reflection SaveGame path)
+// ═══════════════════════════════════════════════════════════════════════
+
+#if !UE_BUILD_SHIPPING
+/**
+ * Hunter.Items.BenchmarkSerialization <BaseItemTablePath> [Count=10000]
+ * Rolls Count items from random rows and compares bytes + save/load time
+ * against SaveGame-tagged reflection serialization.
+ */
+static FAutoConsoleCommand CmdBenchmarkItemSerialization(
+	TEXT("Hunter.Items.BenchmarkSerialization"),
+	TEXT("Compare compact vs reflection item serialization. Args: <BaseItemTablePath> [Count=10000]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (Args.Num() < 1)
+		{
+			UE_LOG(LogItemSerialization, Display, TEXT("Usage: Hunter.Items.BenchmarkSerialization <BaseItemTablePath> [Count]"));
+			return;
+		}
+
+		UDataTable* BaseTable = Cast<UDataTable>(FSoftObjectPath(Args[0]).TryLoad());
+		if (!BaseTable || BaseTable->GetRowNames().Num() == 0)
+		{
+			UE_LOG(LogItemSerialization, Error, TEXT("Benchmark: Could not load base item table '%s'"), *Args[0]);
+			return;
+		}
+
+		const int32 Count = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 10000;
+		const TArray<FName> RowNames = BaseTable->GetRowNames();
+
+		// ═══════════════════════════════════════════════
+		// BUILD STASH
+		// ═══════════════════════════════════════════════
+
+		FRandomStream Rand(12345);
+		TArray<UItemInstance*> Stash;
+		Stash.Reserve(Count);
+
+		for (int32 i = 0; i < Count; ++i)
+		{
+			FDataTableRowHandle Handle;
+			Handle.DataTable = BaseTable;
+			Handle.RowName = RowNames[Rand.RandRange(0, RowNames.Num() - 1)];
+
+			UItemInstance* Item = NewObject<UItemInstance>(GetTransientPackage());
+			Item->SetSeed(Rand.RandHelper(MAX_int32));
+			Item->Initialize(Handle, Rand.RandRange(1, 100),
+				static_cast<EItemRarity>(Rand.RandRange(
+					static_cast<int32>(EItemRarity::IR_GradeF),
+					static_cast<int32>(EItemRarity::IR_GradeSS))));
+			Item->AddToRoot();
+			Stash.Add(Item);
+		}
+
+		// ═══════════════════════════════════════════════
+		// REFLECTION (SaveGame) PATH
+		// ═══════════════════════════════════════════════
+
+		TArray<uint8> ReflectionBytes;
+		double StartTime = FPlatformTime::Seconds();
+		{
+			FMemoryWriter Writer(ReflectionBytes);
+			FObjectAndNameAsStringProxyArchive Proxy(Writer, true);
+			Proxy.ArIsSaveGame = true;
+			for (UItemInstance* Item : Stash)
+			{
+				Item->Serialize(Proxy);
+			}
+		}
+		const double ReflectionSaveMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		StartTime = FPlatformTime::Seconds();
+		{
+			FMemoryReader Reader(ReflectionBytes);
+			FObjectAndNameAsStringProxyArchive Proxy(Reader, true);
+			Proxy.ArIsSaveGame = true;
+			for (int32 i = 0; i < Stash.Num(); ++i)
+			{
+				UItemInstance* Loaded = NewObject<UItemInstance>(GetTransientPackage());
+				Loaded->Serialize(Proxy);
+				Loaded->PostLoadInitialize();
+			}
+		}
+		const double ReflectionLoadMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		// ═══════════════════════════════════════════════
+		// COMPACT PATH
+		// ═══════════════════════════════════════════════
+
+		FItemCompactSerializer Serializer;
+		TArray<uint8> CompactBytes;
+
+		StartTime = FPlatformTime::Seconds();
+		Serializer.SaveItemsToBytes(Stash, CompactBytes);
+		const double CompactSaveMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		TArray<UItemInstance*> LoadedItems;
+		StartTime = FPlatformTime::Seconds();
+		const bool bLoaded = Serializer.LoadItemsFromBytes(CompactBytes, LoadedItems);
+		const double CompactLoadMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		for (UItemInstance* Item : Stash)
+		{
+			Item->RemoveFromRoot();
+		}
+
+		UE_LOG(LogItemSerialization, Display, TEXT("═══════════════════════════════════════════"));
+		UE_LOG(LogItemSerialization, Display, TEXT("ITEM SERIALIZATION BENCHMARK (%d items)"), Count);
+		UE_LOG(LogItemSerialization, Display, TEXT("Reflection: %d bytes (%.1f/item) | save %.2f ms | load %.2f ms"),
+			ReflectionBytes.Num(), ReflectionBytes.Num() / static_cast<float>(Count), ReflectionSaveMs, ReflectionLoadMs);
+		UE_LOG(LogItemSerialization, Display, TEXT("Compact:    %d bytes (%.1f/item) | save %.2f ms | load %.2f ms | %s"),
+			CompactBytes.Num(), CompactBytes.Num() / static_cast<float>(Count), CompactSaveMs, CompactLoadMs,
+			bLoaded && LoadedItems.Num() == Count ? TEXT("OK") : TEXT("LOAD FAILED"));
+		UE_LOG(LogItemSerialization, Display, TEXT("Ratio:      %.1fx smaller"),
+			CompactBytes.Num() > 0 ? ReflectionBytes.Num() / static_cast<float>(CompactBytes.Num()) : 0.0f);
+		UE_LOG(LogItemSerialization, Display, TEXT("═══════════════════════════════════════════"));
+	})
+);
+#endif
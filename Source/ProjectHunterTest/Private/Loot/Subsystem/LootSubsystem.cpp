@@ -125,6 +125,12 @@ bool ULootSubsystem::SpawnLootAtLocation(const FLootResultBatch& Batch, FVector
 	
 	FRandomStream SpreadRandom(GetTypeHash(Location));
 	
+	// OPTIMIZATION: Collect first, then hand the whole drop to the ground subsystem in one batch
+	TArray<UItemInstance*> Items;
+	TArray<FVector> SpawnLocations;
+	Items.Reserve(Batch.Results.Num());
+	SpawnLocations.Reserve(Batch.Results.Num());
+	
 	for (const FLootResult& Result : Batch.Results)
 	{
 		if (!Result.IsValid())
@@ -144,11 +150,17 @@ bool ULootSubsystem::SpawnLootAtLocation(const FLootResultBatch& Batch, FVector
 			SpawnLocation += RandomDir * Distance;
 		}
 		
-		int32 GroundItemID = CachedGroundItemSubsystem->AddItemToGround(Result.Item, SpawnLocation);
-		
-		if (GroundItemID != INDEX_NONE)
+		Items.Add(Result.Item);
+		SpawnLocations.Add(SpawnLocation);
+	}
+	
+	const TArray<int32> GroundItemIDs = CachedGroundItemSubsystem->AddItemsToGround(Items, SpawnLocations);
+	
+	for (int32 i = 0; i < GroundItemIDs.Num(); ++i)
+	{
+		if (GroundItemIDs[i] != INDEX_NONE)
 		{
-			OnLootSpawned.Broadcast(Result.Item, SpawnLocation, GroundItemID);
+			OnLootSpawned.Broadcast(Items[i], SpawnLocations[i], GroundItemIDs[i]);
 		}
 	}
 	
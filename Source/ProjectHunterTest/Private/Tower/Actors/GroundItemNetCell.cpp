@@ -0,0 +1,356 @@
+// Tower/Actors/GroundItemNetCell.cpp
+
+#include "Tower/Actors/GroundItemNetCell.h"
+#include "Tower/Subsystem/GroundItemSubsystem.h"
+#include "Item/Library/ItemStructs.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "Net/UnrealNetwork.h"
+
+// ═══════════════════════════════════════════════════════════════════════
+// NET ENTRY
+// ═══════════════════════════════════════════════════════════════════════
+
+void FGroundItemNetEntry::SetLocation(const FIntPoint& Cell, const FVector& Location)
+{
+	const FVector2D CellMin(Cell.X * AGroundItemNetCell::CellSize, Cell.Y * AGroundItemNetCell::CellSize);
+
+	OffsetX = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Location.X - CellMin.X), 0, MAX_uint16));
+	OffsetY = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Location.Y - CellMin.Y), 0, MAX_uint16));
+	Z = FMath::RoundToInt(Location.Z);
+}
+
+FVector FGroundItemNetEntry::GetLocation(const FIntPoint& Cell) const
+{
+	return FVector(
+		Cell.X * AGroundItemNetCell::CellSize + OffsetX,
+		Cell.Y * AGroundItemNetCell::CellSize + OffsetY,
+		Z);
+}
+
+void FGroundItemNetEntry::SetRotation(const FRotator& Rotation)
+{
+	Yaw = FRotator::CompressAxisToByte(Rotation.Yaw);
+}
+
+FRotator FGroundItemNetEntry::GetRotation() const
+{
+	return FRotator(0.0f, FRotator::DecompressAxisFromByte(Yaw), 0.0f);
+}
+
+void FGroundItemNetEntry::PreReplicatedRemove(const FGroundItemNetArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->ClientRemoveEntry(*this);
+	}
+}
+
+void FGroundItemNetEntry::PostReplicatedAdd(const FGroundItemNetArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->ClientApplyEntry(*this);
+	}
+}
+
+void FGroundItemNetEntry::PostReplicatedChange(const FGroundItemNetArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->ClientApplyEntry(*this);
+	}
+}
+
+bool FGroundItemNetEntry::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint32 PackedID = static_cast<uint32>(ItemID);
+	Ar.SerializeIntPacked(PackedID);
+	ItemID = static_cast<int32>(PackedID);
+
+	uint32 PackedBase = BaseIndex;
+	Ar.SerializeIntPacked(PackedBase);
+	BaseIndex = static_cast<uint16>(PackedBase);
+
+	uint8 RarityByte = static_cast<uint8>(Rarity);
+	Ar << RarityByte;
+	Rarity = static_cast<EItemRarity>(RarityByte);
+
+	uint32 PackedQuantity = static_cast<uint32>(FMath::Max(Quantity, 0));
+	Ar.SerializeIntPacked(PackedQuantity);
+	Quantity = static_cast<int32>(FMath::Min<uint32>(PackedQuantity, MAX_int32));
+
+	Ar << OffsetX;
+	Ar << OffsetY;
+
+	// Zig-zag so small negative heights stay small
+	uint32 PackedZ = (static_cast<uint32>(Z) << 1) ^ static_cast<uint32>(Z >> 31);
+	Ar.SerializeIntPacked(PackedZ);
+	Z = static_cast<int32>(PackedZ >> 1) ^ -static_cast<int32>(PackedZ & 1);
+
+	Ar << Yaw;
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// CELL ACTOR
+// ═══════════════════════════════════════════════════════════════════════
+
+AGroundItemNetCell::AGroundItemNetCell()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	bReplicates = true;
+	bAlwaysRelevant = false;
+	SetReplicatingMovement(false);
+
+	// Changes push a ForceNetUpdate, so the idle rate can stay low
+	SetNetUpdateFrequency(2.0f);
+	SetMinNetUpdateFrequency(1.0f);
+
+	RootSceneComponent = CreateDefaultSubobject<USceneComponent>(TEXT("RootComponent"));
+	SetRootComponent(RootSceneComponent);
+}
+
+void AGroundItemNetCell::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// After property init so a copy from the archetype can't leave it pointing at the CDO
+	Entries.Owner = this;
+}
+
+FIntPoint AGroundItemNetCell::GetCellCoord(const FVector& Location)
+{
+	return FIntPoint(
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize));
+}
+
+void AGroundItemNetCell::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME_CONDITION(AGroundItemNetCell, Cell, COND_InitialOnly);
+	DOREPLIFETIME(AGroundItemNetCell, BasePalette);
+	DOREPLIFETIME(AGroundItemNetCell, Entries);
+}
+
+bool AGroundItemNetCell::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const
+{
+	const FIntPoint ViewerCell = GetCellCoord(SrcLocation);
+
+	return FMath::Abs(ViewerCell.X - Cell.X) <= RelevantCellRadius
+		&& FMath::Abs(ViewerCell.Y - Cell.Y) <= RelevantCellRadius;
+}
+
+void AGroundItemNetCell::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Client: channel closed (out of range) or cell emptied - drop our items locally
+	if (!HasAuthority() && Entries.Items.Num() > 0)
+	{
+		if (UGroundItemSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UGroundItemSubsystem>() : nullptr)
+		{
+			TArray<int32> ItemIDs;
+			ItemIDs.Reserve(Entries.Items.Num());
+			for (const FGroundItemNetEntry& Entry : Entries.Items)
+			{
+				ItemIDs.Add(Entry.ItemID);
+			}
+
+			Subsystem->RemoveReplicatedItems(this, ItemIDs);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// SERVER API
+// ═══════════════════════════════════════════════════════════════════════
+
+void AGroundItemNetCell::InitializeCell(const FIntPoint& InCell)
+{
+	Cell = InCell;
+}
+
+void AGroundItemNetCell::AddEntry(int32 ItemID, const FDataTableRowHandle& BaseItemHandle, EItemRarity Rarity, int32 Quantity, const FVector& Location, const FRotator& Rotation)
+{
+	if (EntryIndexByID.Contains(ItemID))
+	{
+		return;
+	}
+
+	FGroundItemNetEntry& Entry = Entries.Items.AddDefaulted_GetRef();
+	Entry.ItemID = ItemID;
+	Entry.BaseIndex = GetOrAddBaseIndex(BaseItemHandle);
+	Entry.Rarity = Rarity;
+	Entry.Quantity = Quantity;
+	Entry.SetLocation(Cell, Location);
+	Entry.SetRotation(Rotation);
+
+	EntryIndexByID.Add(ItemID, Entries.Items.Num() - 1);
+	Entries.MarkItemDirty(Entry);
+
+	ForceNetUpdate();
+}
+
+bool AGroundItemNetCell::RemoveEntry(int32 ItemID)
+{
+	int32 Index = INDEX_NONE;
+	if (!EntryIndexByID.RemoveAndCopyValue(ItemID, Index))
+	{
+		return false;
+	}
+
+	// Fast array order is not replicated, so swap-remove is safe
+	const int32 LastIndex = Entries.Items.Num() - 1;
+	if (Index != LastIndex)
+	{
+		EntryIndexByID[Entries.Items[LastIndex].ItemID] = Index;
+	}
+
+	Entries.Items.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Entries.MarkArrayDirty();
+
+	ForceNetUpdate();
+	return true;
+}
+
+bool AGroundItemNetCell::UpdateEntryLocation(int32 ItemID, const FVector& Location)
+{
+	const int32* Index = EntryIndexByID.Find(ItemID);
+	if (!Index)
+	{
+		return false;
+	}
+
+	FGroundItemNetEntry& Entry = Entries.Items[*Index];
+	Entry.SetLocation(Cell, Location);
+	Entries.MarkItemDirty(Entry);
+
+	ForceNetUpdate();
+	return true;
+}
+
+bool AGroundItemNetCell::UpdateEntryQuantity(int32 ItemID, int32 Quantity)
+{
+	const int32* Index = EntryIndexByID.Find(ItemID);
+	if (!Index)
+	{
+		return false;
+	}
+
+	FGroundItemNetEntry& Entry = Entries.Items[*Index];
+	if (Entry.Quantity != Quantity)
+	{
+		Entry.Quantity = Quantity;
+		Entries.MarkItemDirty(Entry);
+
+		ForceNetUpdate();
+	}
+	return true;
+}
+
+const FGroundItemNetEntry* AGroundItemNetCell::FindEntry(int32 ItemID) const
+{
+	const int32* Index = EntryIndexByID.Find(ItemID);
+	return Index ? &Entries.Items[*Index] : nullptr;
+}
+
+const FDataTableRowHandle* AGroundItemNetCell::GetBaseItemHandle(uint16 BaseIndex) const
+{
+	return BasePalette.IsValidIndex(BaseIndex) ? &BasePalette[BaseIndex] : nullptr;
+}
+
+uint16 AGroundItemNetCell::GetOrAddBaseIndex(const FDataTableRowHandle& BaseItemHandle)
+{
+	int32 Index = BasePalette.IndexOfByKey(BaseItemHandle);
+	if (Index == INDEX_NONE)
+	{
+		Index = BasePalette.Add(BaseItemHandle);
+	}
+
+	return static_cast<uint16>(Index);
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// CLIENT API
+// ═══════════════════════════════════════════════════════════════════════
+
+void AGroundItemNetCell::ClientApplyEntry(const FGroundItemNetEntry& Entry)
+{
+	if (HasAuthority())
+	{
+		return;
+	}
+
+	UGroundItemSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UGroundItemSubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	UStaticMesh* Mesh = ResolveMesh(Entry.BaseIndex);
+	if (!Mesh)
+	{
+		// Palette row not here yet - retried from OnRep_BasePalette
+		bHasUnresolvedEntries = true;
+		return;
+	}
+
+	Subsystem->ApplyReplicatedItem(this, Entry, Mesh);
+}
+
+void AGroundItemNetCell::ClientRemoveEntry(const FGroundItemNetEntry& Entry)
+{
+	if (HasAuthority())
+	{
+		return;
+	}
+
+	if (UGroundItemSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UGroundItemSubsystem>() : nullptr)
+	{
+		Subsystem->RemoveReplicatedItems(this, { Entry.ItemID });
+	}
+}
+
+void AGroundItemNetCell::OnRep_BasePalette()
+{
+	if (!bHasUnresolvedEntries)
+	{
+		return;
+	}
+
+	bHasUnresolvedEntries = false;
+
+	// Re-apply is idempotent for entries that already made it
+	for (const FGroundItemNetEntry& Entry : Entries.Items)
+	{
+		ClientApplyEntry(Entry);
+	}
+}
+
+UStaticMesh* AGroundItemNetCell::ResolveMesh(uint16 BaseIndex)
+{
+	if (!BasePalette.IsValidIndex(BaseIndex))
+	{
+		return nullptr;
+	}
+
+	if (ResolvedMeshes.Num() < BasePalette.Num())
+	{
+		ResolvedMeshes.SetNumZeroed(BasePalette.Num());
+	}
+
+	if (!ResolvedMeshes[BaseIndex])
+	{
+		if (const FItemBase* Base = BasePalette[BaseIndex].GetRow<FItemBase>(TEXT("GroundItemNetCell")))
+		{
+			ResolvedMeshes[BaseIndex] = Base->StaticMesh.Get();
+		}
+	}
+
+	return ResolvedMeshes[BaseIndex];
+}
@@ -0,0 +1,33 @@
+// Tower/Subsystem/GroundItemFloorCache.cpp
+
+#include "Tower/Subsystem/GroundItemFloorCache.h"
+
+void UGroundItemFloorCache::StoreFloor(FName FloorID, TArray<uint8>&& Bytes)
+{
+	Floors.Add(FloorID, MoveTemp(Bytes));
+}
+
+bool UGroundItemFloorCache::TakeFloor(FName FloorID, TArray<uint8>& OutBytes)
+{
+	return Floors.RemoveAndCopyValue(FloorID, OutBytes);
+}
+
+void UGroundItemFloorCache::ForgetFloor(FName FloorID)
+{
+	Floors.Remove(FloorID);
+}
+
+void UGroundItemFloorCache::ForgetAllFloors()
+{
+	Floors.Empty();
+}
+
+int64 UGroundItemFloorCache::GetTotalBytes() const
+{
+	int64 Total = 0;
+	for (const TPair<FName, TArray<uint8>>& Pair : Floors)
+	{
+		Total += Pair.Value.Num();
+	}
+	return Total;
+}
@@ -0,0 +1,73 @@
+// Tower/Subsystem/GroundItemLifetime.cpp
+
+#include "Tower/Subsystem/GroundItemLifetime.h"
+
+// ═══════════════════════════════════════════════════════════════════════
+// TIMING WHEEL
+// ═══════════════════════════════════════════════════════════════════════
+
+void FGroundItemTimingWheel::Schedule(int32 ItemID, uint32 Generation, float CurrentTime, float Lifetime)
+{
+	if (CurrentTick < 0)
+	{
+		CurrentTick = TimeToTick(CurrentTime);
+	}
+
+	const int64 ExpireTick = TimeToTick(CurrentTime + Lifetime);
+
+	// Never schedule into a slot the clock has already passed
+	const int64 Delta = FMath::Max<int64>(ExpireTick - CurrentTick, 1);
+	const int64 TargetTick = CurrentTick + Delta;
+
+	FEntry Entry;
+	Entry.ItemID = ItemID;
+	Entry.Generation = Generation;
+	Entry.LapsRemaining = static_cast<int32>((Delta - 1) / NumSlots);
+
+	Slots[TargetTick & (NumSlots - 1)].Add(Entry);
+	NumScheduled++;
+}
+
+void FGroundItemTimingWheel::Advance(float CurrentTime, TArray<FExpired>& OutExpired)
+{
+	const int64 TargetTick = TimeToTick(CurrentTime);
+
+	if (CurrentTick < 0)
+	{
+		CurrentTick = TargetTick;
+		return;
+	}
+
+	// Visit at most one lap of slots - after a very long hitch, lapped entries expire late rather than stalling here
+	const int64 StepsToRun = FMath::Min<int64>(TargetTick - CurrentTick, NumSlots);
+	for (int64 Step = 0; Step < StepsToRun; ++Step)
+	{
+		TArray<FEntry>& Slot = Slots[(CurrentTick + 1 + Step) & (NumSlots - 1)];
+
+		for (int32 i = Slot.Num() - 1; i >= 0; --i)
+		{
+			if (Slot[i].LapsRemaining > 0)
+			{
+				Slot[i].LapsRemaining--;
+				continue;
+			}
+
+			OutExpired.Add({ Slot[i].ItemID, Slot[i].Generation });
+			Slot.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			NumScheduled--;
+		}
+	}
+
+	CurrentTick = FMath::Max(CurrentTick, TargetTick);
+}
+
+void FGroundItemTimingWheel::Reset()
+{
+	for (TArray<FEntry>& Slot : Slots)
+	{
+		Slot.Empty();
+	}
+
+	CurrentTick = -1;
+	NumScheduled = 0;
+}
@@ -0,0 +1,600 @@
+// Tower/Subsystem/GroundItemReplicator.cpp
+
+#include "Tower/Subsystem/GroundItemReplicator.h"
+#include "Tower/Actors/GroundItemNetCell.h"
+#include "Item/ItemInstance.h"
+#include "Engine/World.h"
+#include "Tower/Subsystem/GroundItemSubsystem.h"
+#include "Item/Library/ItemStructs.h"
+#include "Engine/DataTable.h"
+#include "Engine/Engine.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetConnection.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "Containers/Ticker.h"
+#include "UObject/StrongObjectPtr.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY(LogGroundItemReplication);
+
+FGroundItemReplicator::FGroundItemReplicator()
+	: WorldContext(nullptr)
+{
+}
+
+void FGroundItemReplicator::Initialize(UWorld* World)
+{
+	WorldContext = World;
+}
+
+bool FGroundItemReplicator::IsActive() const
+{
+	if (!WorldContext)
+	{
+		return false;
+	}
+
+	const ENetMode NetMode = WorldContext->GetNetMode();
+	return NetMode == NM_DedicatedServer || NetMode == NM_ListenServer;
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// MIRRORING
+// ═══════════════════════════════════════════════════════════════════════
+
+void FGroundItemReplicator::AddItem(int32 ItemID, const UItemInstance* Item, const FVector& Location, const FRotator& Rotation)
+{
+	if (!Item)
+	{
+		return;
+	}
+
+	if (AGroundItemNetCell* Cell = FindOrSpawnCell(AGroundItemNetCell::GetCellCoord(Location)))
+	{
+		Cell->AddEntry(ItemID, Item->BaseItemHandle, Item->Rarity, Item->Quantity, Location, Rotation);
+	}
+}
+
+void FGroundItemReplicator::RemoveItem(int32 ItemID, const FVector& Location)
+{
+	AGroundItemNetCell* Cell = FindCell(AGroundItemNetCell::GetCellCoord(Location));
+	if (Cell && Cell->RemoveEntry(ItemID))
+	{
+		ReleaseIfEmpty(Cell);
+	}
+}
+
+void FGroundItemReplicator::MoveItem(int32 ItemID, const FVector& OldLocation, const FVector& NewLocation)
+{
+	const FIntPoint OldCoord = AGroundItemNetCell::GetCellCoord(OldLocation);
+	const FIntPoint NewCoord = AGroundItemNetCell::GetCellCoord(NewLocation);
+
+	AGroundItemNetCell* OldCell = FindCell(OldCoord);
+	if (!OldCell)
+	{
+		return;
+	}
+
+	if (OldCoord == NewCoord)
+	{
+		OldCell->UpdateEntryLocation(ItemID, NewLocation);
+		return;
+	}
+
+	const FGroundItemNetEntry* OldEntry = OldCell->FindEntry(ItemID);
+	const FDataTableRowHandle* BaseHandle = OldEntry ? OldCell->GetBaseItemHandle(OldEntry->BaseIndex) : nullptr;
+	if (!OldEntry || !BaseHandle)
+	{
+		return;
+	}
+
+	// Copy before removal invalidates the entry
+	const FDataTableRowHandle Handle = *BaseHandle;
+	const EItemRarity Rarity = OldEntry->Rarity;
+	const int32 Quantity = OldEntry->Quantity;
+	const FRotator Rotation = OldEntry->GetRotation();
+
+	OldCell->RemoveEntry(ItemID);
+	ReleaseIfEmpty(OldCell);
+
+	if (AGroundItemNetCell* NewCell = FindOrSpawnCell(NewCoord))
+	{
+		NewCell->AddEntry(ItemID, Handle, Rarity, Quantity, NewLocation, Rotation);
+	}
+}
+
+void FGroundItemReplicator::RefreshItem(int32 ItemID, const UItemInstance* Item, const FVector& Location)
+{
+	AGroundItemNetCell* Cell = FindCell(AGroundItemNetCell::GetCellCoord(Location));
+	if (Item && Cell)
+	{
+		Cell->UpdateEntryQuantity(ItemID, Item->Quantity);
+	}
+}
+
+void FGroundItemReplicator::Reset()
+{
+	for (TPair<FIntPoint, TWeakObjectPtr<AGroundItemNetCell>>& Pair : Cells)
+	{
+		if (AGroundItemNetCell* Cell = Pair.Value.Get())
+		{
+			Cell->Destroy();
+		}
+	}
+
+	Cells.Empty();
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// INTERNAL
+// ═══════════════════════════════════════════════════════════════════════
+
+AGroundItemNetCell* FGroundItemReplicator::FindCell(const FIntPoint& CellCoord) const
+{
+	const TWeakObjectPtr<AGroundItemNetCell>* Found = Cells.Find(CellCoord);
+	return Found ? Found->Get() : nullptr;
+}
+
+AGroundItemNetCell* FGroundItemReplicator::FindOrSpawnCell(const FIntPoint& CellCoord)
+{
+	if (AGroundItemNetCell* Existing = FindCell(CellCoord))
+	{
+		return Existing;
+	}
+
+	if (!WorldContext || !WorldContext->HasBegunPlay())
+	{
+		return nullptr;
+	}
+
+	const FVector CellCenter(
+		(CellCoord.X + 0.5f) * AGroundItemNetCell::CellSize,
+		(CellCoord.Y + 0.5f) * AGroundItemNetCell::CellSize,
+		0.0f);
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	Params.ObjectFlags = RF_Transient;
+	Params.bDeferConstruction = true;
+
+	AGroundItemNetCell* Cell = WorldContext->SpawnActor<AGroundItemNetCell>(
+		AGroundItemNetCell::StaticClass(),
+		CellCenter,
+		FRotator::ZeroRotator,
+		Params
+	);
+
+	if (!Cell)
+	{
+		UE_LOG(LogGroundItemReplication, Error, TEXT("GroundItemReplicator: Failed to spawn net cell %s"), *CellCoord.ToString());
+		return nullptr;
+	}
+
+	Cell->InitializeCell(CellCoord);
+	Cell->FinishSpawning(FTransform(CellCenter));
+
+	Cells.Add(CellCoord, Cell);
+
+	UE_LOG(LogGroundItemReplication, Verbose, TEXT("GroundItemReplicator: Spawned net cell %s"), *CellCoord.ToString());
+
+	return Cell;
+}
+
+void FGroundItemReplicator::ReleaseIfEmpty(AGroundItemNetCell* Cell)
+{
+	if (Cell->GetNumEntries() > 0)
+	{
+		return;
+	}
+
+	Cells.Remove(Cell->GetCell());
+	Cell->Destroy();
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// BANDWIDTH MEASUREMENT
+// ═══════════════════════════════════════════════════════════════════════
+
+#if !UE_BUILD_SHIPPING
+/**
+ * Measures what the server's net driver actually sends to each client connection while
+ * ground items are spawned and churned. Three equal windows:
+ *   Idle    - nothing spawned; the per-connection rate every other window is compared to
+ *   Initial - all items spawned at the start; cells open channels and send their contents
+ *   Churn   - each second a fraction of the items is removed and as many new ones dropped
+ * Only the items it spawned are touched, and they are removed when it finishes.
+ */
+class FGroundItemReplicationMeasurement : public TSharedFromThis<FGroundItemReplicationMeasurement>
+{
+public:
+	enum class EPhase : uint8
+	{
+		Idle,
+		Initial,
+		Churn
+	};
+
+	FGroundItemReplicationMeasurement(UWorld* InWorld, UDataTable* InBaseTable, TArray<FName>&& InRows,
+		int32 InNumItems, float InWindowSeconds, float InChurn, float InAreaSize, const FVector& InCenter)
+		: World(InWorld)
+		, BaseTable(InBaseTable)
+		, Rows(MoveTemp(InRows))
+		, NumItems(InNumItems)
+		, WindowSeconds(InWindowSeconds)
+		, Churn(InChurn)
+		, AreaSize(InAreaSize)
+		, Center(InCenter)
+		, Rand(12345)
+	{
+	}
+
+	void Start()
+	{
+		BeginWindow(EPhase::Idle);
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FGroundItemReplicationMeasurement::Tick));
+
+		UE_LOG(LogGroundItemReplication, Display, TEXT("MeasureReplication: %d items, %.1fs windows, %d client connections"),
+			NumItems, WindowSeconds, GetNetDriver() ? GetNetDriver()->ClientConnections.Num() : 0);
+	}
+
+	/** The single running measurement (kept alive here while the ticker runs) */
+	static TSharedPtr<FGroundItemReplicationMeasurement> Active;
+
+private:
+	struct FWindow
+	{
+		TMap<TObjectKey<UNetConnection>, int64> StartBytes;
+		TMap<TObjectKey<UNetConnection>, int64> Bytes;
+		int64 DriverStartBytes = 0;
+		int64 DriverBytes = 0;
+	};
+
+	UNetDriver* GetNetDriver() const
+	{
+		const UWorld* PlayWorld = World.Get();
+		return PlayWorld ? PlayWorld->GetNetDriver() : nullptr;
+	}
+
+	UGroundItemSubsystem* GetSubsystem() const
+	{
+		UWorld* PlayWorld = World.Get();
+		return PlayWorld ? PlayWorld->GetSubsystem<UGroundItemSubsystem>() : nullptr;
+	}
+
+	bool Tick(float DeltaTime)
+	{
+		UNetDriver* NetDriver = GetNetDriver();
+		UGroundItemSubsystem* Subsystem = GetSubsystem();
+		if (!NetDriver || !Subsystem)
+		{
+			UE_LOG(LogGroundItemReplication, Warning, TEXT("MeasureReplication: World or net driver went away - aborted"));
+			Finish(false);
+			return false;
+		}
+
+		Elapsed += DeltaTime;
+
+		if (Phase == EPhase::Churn)
+		{
+			// One churn batch per whole second of the window
+			while (ChurnSecondsDone < FMath::FloorToInt(Elapsed))
+			{
+				ChurnOnce(*Subsystem);
+				ChurnSecondsDone++;
+			}
+		}
+
+		if (Elapsed < WindowSeconds)
+		{
+			return true;
+		}
+
+		EndWindow(Windows[static_cast<int32>(Phase)]);
+
+		switch (Phase)
+		{
+		case EPhase::Idle:
+			SpawnItems(*Subsystem, NumItems);
+			BeginWindow(EPhase::Initial);
+			return true;
+
+		case EPhase::Initial:
+			BeginWindow(EPhase::Churn);
+			return true;
+
+		default:
+			Finish(true);
+			return false;
+		}
+	}
+
+	void BeginWindow(EPhase NewPhase)
+	{
+		Phase = NewPhase;
+		Elapsed = 0.0f;
+		ChurnSecondsDone = 0;
+
+		FWindow& Window = Windows[static_cast<int32>(Phase)];
+		Window = FWindow();
+
+		if (const UNetDriver* NetDriver = GetNetDriver())
+		{
+			for (const UNetConnection* Connection : NetDriver->ClientConnections)
+			{
+				if (Connection)
+				{
+					Window.StartBytes.Add(Connection, static_cast<int64>(Connection->OutTotalBytes));
+				}
+			}
+			Window.DriverStartBytes = static_cast<int64>(NetDriver->OutTotalBytes);
+		}
+	}
+
+	void EndWindow(FWindow& Window) const
+	{
+		const UNetDriver* NetDriver = GetNetDriver();
+		if (!NetDriver)
+		{
+			return;
+		}
+
+		// Connections that joined mid-window are left out - they have no start sample
+		for (const UNetConnection* Connection : NetDriver->ClientConnections)
+		{
+			const int64* StartBytes = Connection ? Window.StartBytes.Find(Connection) : nullptr;
+			if (StartBytes)
+			{
+				Window.Bytes.Add(Connection, static_cast<int64>(Connection->OutTotalBytes) - *StartBytes);
+			}
+		}
+		Window.DriverBytes = static_cast<int64>(NetDriver->OutTotalBytes) - Window.DriverStartBytes;
+	}
+
+	/** Drop items over a square centred on the connected pawns (so some cells are out of relevancy) */
+	void SpawnItems(UGroundItemSubsystem& Subsystem, int32 Count)
+	{
+		if (Count <= 0)
+		{
+			return;
+		}
+
+		TArray<UItemInstance*> Items;
+		TArray<FVector> Locations;
+		Items.Reserve(Count);
+		Locations.Reserve(Count);
+
+		for (int32 i = 0; i < Count; ++i)
+		{
+			FDataTableRowHandle Handle;
+			Handle.DataTable = BaseTable.Get();
+			Handle.RowName = Rows[Rand.RandRange(0, Rows.Num() - 1)];
+
+			UItemInstance* Item = NewObject<UItemInstance>(GetTransientPackage());
+			Item->SetSeed(Rand.RandHelper(MAX_int32));
+			Item->Initialize(Handle, Rand.RandRange(1, 100),
+				static_cast<EItemRarity>(Rand.RandRange(
+					static_cast<int32>(EItemRarity::IR_GradeF),
+					static_cast<int32>(EItemRarity::IR_GradeSS))), false);
+			Item->AddToRoot();
+			Items.Add(Item);
+
+			Locations.Emplace(
+				Center.X + Rand.FRandRange(-0.5f, 0.5f) * AreaSize,
+				Center.Y + Rand.FRandRange(-0.5f, 0.5f) * AreaSize,
+				Center.Z);
+		}
+
+		SpawnedIDs.Append(Subsystem.AddItemsToGround(Items, Locations));
+	}
+
+	void RemoveItems(UGroundItemSubsystem& Subsystem, const TArray<int32>& ItemIDs)
+	{
+		for (UItemInstance* Item : Subsystem.RemoveMultipleItemsFromGround(ItemIDs))
+		{
+			if (Item)
+			{
+				Item->RemoveFromRoot();
+			}
+		}
+	}
+
+	void ChurnOnce(UGroundItemSubsystem& Subsystem)
+	{
+		const int32 NumChanged = FMath::Min(FMath::RoundToInt(NumItems * Churn), SpawnedIDs.Num());
+
+		TArray<int32> Removed;
+		Removed.Reserve(NumChanged);
+		for (int32 i = 0; i < NumChanged; ++i)
+		{
+			const int32 Index = Rand.RandRange(0, SpawnedIDs.Num() - 1);
+			Removed.Add(SpawnedIDs[Index]);
+			SpawnedIDs.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		}
+
+		RemoveItems(Subsystem, Removed);
+		SpawnItems(Subsystem, NumChanged);
+	}
+
+	void Finish(bool bReport)
+	{
+		if (UGroundItemSubsystem* Subsystem = GetSubsystem())
+		{
+			RemoveItems(*Subsystem, SpawnedIDs);
+		}
+		SpawnedIDs.Empty();
+
+		if (bReport)
+		{
+			Report();
+		}
+
+		// Released after the ticker drops its delegate
+		Active.Reset();
+	}
+
+	void Report() const
+	{
+		const FWindow& Idle = Windows[static_cast<int32>(EPhase::Idle)];
+		const FWindow& Initial = Windows[static_cast<int32>(EPhase::Initial)];
+		const FWindow& ChurnWindow = Windows[static_cast<int32>(EPhase::Churn)];
+
+		const double Window = FMath::Max(WindowSeconds, UE_KINDA_SMALL_NUMBER);
+
+		UE_LOG(LogGroundItemReplication, Display, TEXT("═══════════════════════════════════════════"));
+		UE_LOG(LogGroundItemReplication, Display, TEXT("GROUND ITEM REPLICATION (measured: %d items, %.0f cm area, %.0f%% churn/s, %.1fs windows)"),
+			NumItems, AreaSize, Churn * 100.0f, WindowSeconds);
+
+		int32 NumConnections = 0;
+		for (const TPair<TObjectKey<UNetConnection>, int64>& Pair : Initial.Bytes)
+		{
+			const int64* IdleBytes = Idle.Bytes.Find(Pair.Key);
+			const int64* ChurnBytes = ChurnWindow.Bytes.Find(Pair.Key);
+			if (!IdleBytes || !ChurnBytes)
+			{
+				continue;
+			}
+
+			const UNetConnection* Connection = Pair.Key.ResolveObjectPtr();
+			const FString Name = Connection && Connection->PlayerController ? Connection->PlayerController->GetName() : FString(TEXT("<closed>"));
+
+			// Everything else the connection sends (movement, other actors) is what the idle window saw
+			UE_LOG(LogGroundItemReplication, Display, TEXT("%-24s idle %7.2f KB/s | initial +%8.1f KB | churn +%6.2f KB/s"),
+				*Name,
+				*IdleBytes / Window / 1024.0,
+				(Pair.Value - *IdleBytes) / 1024.0,
+				(*ChurnBytes - *IdleBytes) / Window / 1024.0);
+
+			NumConnections++;
+		}
+
+		UE_LOG(LogGroundItemReplication, Display, TEXT("Net driver (%d connections): idle %.2f KB/s | initial +%.1f KB | churn +%.2f KB/s"),
+			NumConnections,
+			Idle.DriverBytes / Window / 1024.0,
+			(Initial.DriverBytes - Idle.DriverBytes) / 1024.0,
+			(ChurnWindow.DriverBytes - Idle.DriverBytes) / Window / 1024.0);
+		UE_LOG(LogGroundItemReplication, Display, TEXT("═══════════════════════════════════════════"));
+	}
+
+	TWeakObjectPtr<UWorld> World;
+	TStrongObjectPtr<UDataTable> BaseTable;
+	TArray<FName> Rows;
+
+	int32 NumItems;
+	float WindowSeconds;
+	float Churn;
+	float AreaSize;
+
+	/** Centre of the drop area */
+	FVector Center;
+
+	FRandomStream Rand;
+
+	EPhase Phase = EPhase::Idle;
+	float Elapsed = 0.0f;
+	int32 ChurnSecondsDone = 0;
+	FWindow Windows[3];
+
+	TArray<int32> SpawnedIDs;
+};
+
+TSharedPtr<FGroundItemReplicationMeasurement> FGroundItemReplicationMeasurement::Active;
+
+/**
+ * Hunter.GroundItems.MeasureReplication <BaseItemTablePath> [Items=5000] [Seconds=5] [Churn=0.1] [AreaSize=40000]
+ * Run on a listen or dedicated server with the clients already connected, e.g. PIE with
+ * 4 players as listen server, or -server plus 4 -game clients. Reports net driver and
+ * per-connection bytes sent, measured over idle, initial and churn windows.
+ */
+static FAutoConsoleCommandWithWorldAndArgs CmdMeasureGroundItemReplication(
+	TEXT("Hunter.GroundItems.MeasureReplication"),
+	TEXT("Measure ground item replication traffic on a server. Args: <BaseItemTablePath> [Items=5000] [Seconds=5] [Churn=0.1] [AreaSize=40000]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (FGroundItemReplicationMeasurement::Active.IsValid())
+		{
+			UE_LOG(LogGroundItemReplication, Warning, TEXT("MeasureReplication: Already running"));
+			return;
+		}
+
+		if (Args.Num() < 1)
+		{
+			UE_LOG(LogGroundItemReplication, Display, TEXT("Usage: Hunter.GroundItems.MeasureReplication <BaseItemTablePath> [Items] [Seconds] [Churn] [AreaSize]"));
+			return;
+		}
+
+		// The console may belong to a client window (PIE) - measure on the server world
+		auto IsServerWorld = [](const UWorld* Candidate)
+		{
+			return Candidate && Candidate->HasBegunPlay() && Candidate->GetNetDriver() &&
+				(Candidate->GetNetMode() == NM_ListenServer || Candidate->GetNetMode() == NM_DedicatedServer);
+		};
+
+		if (!IsServerWorld(World))
+		{
+			World = nullptr;
+			for (const FWorldContext& Context : GEngine->GetWorldContexts())
+			{
+				if (IsServerWorld(Context.World()))
+				{
+					World = Context.World();
+					break;
+				}
+			}
+		}
+
+		if (!World)
+		{
+			UE_LOG(LogGroundItemReplication, Error, TEXT("MeasureReplication: Needs a listen or dedicated server with clients connected"));
+			return;
+		}
+
+		UDataTable* BaseTable = Cast<UDataTable>(FSoftObjectPath(Args[0]).TryLoad());
+		if (!BaseTable)
+		{
+			UE_LOG(LogGroundItemReplication, Error, TEXT("MeasureReplication: Could not load base item table '%s'"), *Args[0]);
+			return;
+		}
+
+		// Clients resolve the palette row, so only rows with a ground mesh are useful
+		TArray<FName> Rows;
+		for (const FName& RowName : BaseTable->GetRowNames())
+		{
+			const FItemBase* Row = BaseTable->FindRow<FItemBase>(RowName, TEXT("MeasureReplication"), false);
+			if (Row && Row->StaticMesh)
+			{
+				Rows.Add(RowName);
+			}
+		}
+
+		if (Rows.Num() == 0)
+		{
+			UE_LOG(LogGroundItemReplication, Error, TEXT("MeasureReplication: No rows with a ground mesh in '%s'"), *Args[0]);
+			return;
+		}
+
+		const int32 NumItems = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 5000;
+		const float WindowSeconds = Args.Num() > 2 ? FMath::Max(1.0f, FCString::Atof(*Args[2])) : 5.0f;
+		const float Churn = Args.Num() > 3 ? FMath::Clamp(FCString::Atof(*Args[3]), 0.0f, 1.0f) : 0.1f;
+		const float AreaSize = Args.Num() > 4 ? FMath::Max(AGroundItemNetCell::CellSize, FCString::Atof(*Args[4])) : 40000.0f;
+
+		// Centre on the players so the area straddles relevant and irrelevant cells
+		FVector PawnSum = FVector::ZeroVector;
+		int32 NumPawns = 0;
+		for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+		{
+			const APlayerController* PC = It->Get();
+			if (const APawn* Pawn = PC ? PC->GetPawn() : nullptr)
+			{
+				PawnSum += Pawn->GetActorLocation();
+				NumPawns++;
+			}
+		}
+		const FVector Center = NumPawns > 0 ? PawnSum / NumPawns : FVector::ZeroVector;
+
+		FGroundItemReplicationMeasurement::Active = MakeShared<FGroundItemReplicationMeasurement>(
+			World, BaseTable, MoveTemp(Rows), NumItems, WindowSeconds, Churn, AreaSize, Center);
+		FGroundItemReplicationMeasurement::Active->Start();
+	})
+);
+#endif
@@ -0,0 +1,180 @@
+// Tower/Subsystem/GroundItemSnapshot.cpp
+
+#include "Tower/Subsystem/GroundItemSnapshot.h"
+#include "Item/ItemInstance.h"
+#include "Serialization/MemoryWriter.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogGroundItemSnapshot, Log, All);
+DEFINE_LOG_CATEGORY(LogGroundItemSnapshot);
+
+namespace GroundItemSnapshot
+{
+	/** 'PHGF' - Project Hunter Ground Floor */
+	constexpr uint32 Magic = 0x50484746;
+	constexpr uint8 Version = 1;
+
+	/** Smallest record on disk: packed ID (1+) + FVector3f (12) + yaw (1) + age (2) */
+	constexpr int64 MinRecordBytes = 1 + 12 + 1 + 2;
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// WRITE
+// ═══════════════════════════════════════════════════════════════════════
+
+bool FGroundItemSnapshot::Write(const TArray<FGroundItemSnapshotRecord>& Records, const TArray<UItemInstance*>& Items, TArray<uint8>& OutBytes)
+{
+	check(Records.Num() == Items.Num());
+
+	OutBytes.Reset();
+
+	// Items go through the shared compact format (base row + seed + rolled affixes).
+	// They are encoded first: the serializer skips items it cannot encode, and the
+	// record count must match what it wrote or Open() rejects the whole floor.
+	FItemCompactSerializer Serializer;
+	TArray<UItemInstance*> ItemsCopy = Items;
+	TArray<uint8> ItemBytes;
+	TArray<int32> WrittenIndices;
+	{
+		FMemoryWriter ItemWriter(ItemBytes);
+		if (!Serializer.SerializeItems(ItemWriter, ItemsCopy, nullptr, &WrittenIndices) || ItemWriter.IsError())
+		{
+			return false;
+		}
+	}
+
+	if (WrittenIndices.Num() != Records.Num())
+	{
+		UE_LOG(LogGroundItemSnapshot, Warning, TEXT("GroundItemSnapshot: %d of %d items could not be serialized and were dropped"),
+			Records.Num() - WrittenIndices.Num(), Records.Num());
+	}
+
+	FMemoryWriter Writer(OutBytes);
+
+	uint32 MagicValue = GroundItemSnapshot::Magic;
+	uint8 VersionValue = GroundItemSnapshot::Version;
+	uint32 Count = WrittenIndices.Num();
+	Writer << MagicValue;
+	Writer << VersionValue;
+	Writer.SerializeIntPacked(Count);
+
+	for (int32 RecordIndex : WrittenIndices)
+	{
+		const FGroundItemSnapshotRecord& Record = Records[RecordIndex];
+		uint32 PackedID = static_cast<uint32>(Record.ItemID);
+		FVector3f Location(Record.Location);
+		uint8 Yaw = FRotator::CompressAxisToByte(Record.Yaw);
+		uint16 Age = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Record.Age), 0, MAX_uint16));
+
+		Writer.SerializeIntPacked(PackedID);
+		Writer << Location;
+		Writer << Yaw;
+		Writer << Age;
+	}
+
+	Writer.Serialize(ItemBytes.GetData(), ItemBytes.Num());
+	return !Writer.IsError();
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// STREAMING READ
+// ═══════════════════════════════════════════════════════════════════════
+
+bool FGroundItemSnapshot::Open(TArray<uint8>&& InBytes)
+{
+	Bytes = MoveTemp(InBytes);
+	Reader = MakeUnique<FMemoryReader>(Bytes);
+	Records.Reset();
+	NextIndex = 0;
+	MaxItemID = INDEX_NONE;
+	bFailed = true;
+
+	uint32 MagicValue = 0;
+	uint8 VersionValue = 0;
+	uint32 Count = 0;
+	*Reader << MagicValue;
+	*Reader << VersionValue;
+	Reader->SerializeIntPacked(Count);
+
+	if (MagicValue != GroundItemSnapshot::Magic || VersionValue == 0 || VersionValue > GroundItemSnapshot::Version)
+	{
+		UE_LOG(LogGroundItemSnapshot, Error, TEXT("GroundItemSnapshot: Bad header (magic 0x%08x, version %d)"), MagicValue, VersionValue);
+		return false;
+	}
+
+	// A count the remaining bytes cannot hold is corrupt - reject it before it sizes an allocation
+	const int64 MaxCount = (Reader->TotalSize() - Reader->Tell()) / GroundItemSnapshot::MinRecordBytes;
+	if (static_cast<int64>(Count) > MaxCount)
+	{
+		UE_LOG(LogGroundItemSnapshot, Error, TEXT("GroundItemSnapshot: Corrupt blob (%u records claimed, room for %lld)"), Count, MaxCount);
+		return false;
+	}
+
+	Records.Reserve(Count);
+	for (uint32 i = 0; i < Count && !Reader->IsError(); ++i)
+	{
+		uint32 PackedID = 0;
+		FVector3f Location;
+		uint8 Yaw = 0;
+		uint16 Age = 0;
+
+		Reader->SerializeIntPacked(PackedID);
+		*Reader << Location;
+		*Reader << Yaw;
+		*Reader << Age;
+
+		FGroundItemSnapshotRecord& Record = Records.AddDefaulted_GetRef();
+		Record.ItemID = static_cast<int32>(PackedID);
+		Record.Location = FVector(Location);
+		Record.Yaw = FRotator::DecompressAxisFromByte(Yaw);
+		Record.Age = Age;
+
+		MaxItemID = FMath::Max(MaxItemID, Record.ItemID);
+	}
+
+	int32 ItemCount = 0;
+	if (Reader->IsError() || !Serializer.BeginReadItems(*Reader, ItemCount) || ItemCount != Records.Num())
+	{
+		UE_LOG(LogGroundItemSnapshot, Error, TEXT("GroundItemSnapshot: Corrupt blob (%d records)"), Records.Num());
+		Records.Reset();
+		return false;
+	}
+
+	bFailed = false;
+	return true;
+}
+
+int32 FGroundItemSnapshot::ReadItems(double BudgetSeconds, TArray<UItemInstance*>& OutItems, TArray<FGroundItemSnapshotRecord>& OutRecords, UObject* Outer)
+{
+	if (IsDone())
+	{
+		return 0;
+	}
+
+	const double EndTime = FPlatformTime::Seconds() + BudgetSeconds;
+	int32 NumRead = 0;
+
+	do
+	{
+		UItemInstance* Item = Serializer.ReadNextItem(*Reader, Outer);
+		if (!Item)
+		{
+			UE_LOG(LogGroundItemSnapshot, Error, TEXT("GroundItemSnapshot: Failed to read item %d/%d - dropping the rest"),
+				NextIndex, Records.Num());
+			bFailed = true;
+			break;
+		}
+
+		OutItems.Add(Item);
+		OutRecords.Add(Records[NextIndex]);
+		NextIndex++;
+		NumRead++;
+	}
+	while (!IsDone() && FPlatformTime::Seconds() < EndTime);
+
+	if (IsDone())
+	{
+		Serializer.EndReadItems();
+	}
+
+	return NumRead;
+}
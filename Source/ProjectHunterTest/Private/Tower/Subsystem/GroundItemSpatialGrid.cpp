@@ -0,0 +1,211 @@
+// Tower/Subsystem/GroundItemSpatialGrid.cpp
+
+#include "Tower/Subsystem/GroundItemSpatialGrid.h"
+
+FGroundItemSpatialGrid::FGroundItemSpatialGrid(float InCellSize)
+	: CellSize(FMath::Max(InCellSize, 1.0f))
+	, InvCellSize(1.0f / FMath::Max(InCellSize, 1.0f))
+{
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// MAINTENANCE
+// ═══════════════════════════════════════════════════════════════════════
+
+void FGroundItemSpatialGrid::Add(int32 ItemID, const FVector& Location)
+{
+	FCell& Cell = Cells.FindOrAdd(GetCellCoord(Location));
+	Cell.ItemIDs.Add(ItemID);
+	Cell.Locations.Add(Location);
+}
+
+bool FGroundItemSpatialGrid::Remove(int32 ItemID, const FVector& Location)
+{
+	const FIntPoint CellCoord = GetCellCoord(Location);
+	FCell* Cell = Cells.Find(CellCoord);
+	if (!Cell)
+	{
+		return false;
+	}
+
+	const int32 Index = Cell->ItemIDs.Find(ItemID);
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// Order inside a cell doesn't matter - swap keeps removal O(1) after the find
+	Cell->ItemIDs.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Cell->Locations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	if (Cell->ItemIDs.Num() == 0)
+	{
+		Cells.Remove(CellCoord);
+	}
+
+	return true;
+}
+
+void FGroundItemSpatialGrid::Move(int32 ItemID, const FVector& OldLocation, const FVector& NewLocation)
+{
+	const FIntPoint OldCell = GetCellCoord(OldLocation);
+	const FIntPoint NewCell = GetCellCoord(NewLocation);
+
+	if (OldCell == NewCell)
+	{
+		if (FCell* Cell = Cells.Find(OldCell))
+		{
+			const int32 Index = Cell->ItemIDs.Find(ItemID);
+			if (Index != INDEX_NONE)
+			{
+				Cell->Locations[Index] = NewLocation;
+				return;
+			}
+		}
+	}
+	else
+	{
+		Remove(ItemID, OldLocation);
+	}
+
+	Add(ItemID, NewLocation);
+}
+
+void FGroundItemSpatialGrid::Reset()
+{
+	Cells.Empty();
+}
+
+SIZE_T FGroundItemSpatialGrid::GetAllocatedSize() const
+{
+	SIZE_T Size = Cells.GetAllocatedSize();
+	for (const TPair<FIntPoint, FCell>& Pair : Cells)
+	{
+		Size += Pair.Value.ItemIDs.GetAllocatedSize() + Pair.Value.Locations.GetAllocatedSize();
+	}
+	return Size;
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// QUERIES
+// ═══════════════════════════════════════════════════════════════════════
+
+int32 FGroundItemSpatialGrid::FindNearest(const FVector& Location, float MaxDistance, float* OutDistSq) const
+{
+	int32 BestID = INDEX_NONE;
+	float BestDistSq = MaxDistance * MaxDistance;
+
+	if (Cells.Num() > 0)
+	{
+		const FIntPoint Center = GetCellCoord(Location);
+		const int32 MaxRing = FMath::CeilToInt(MaxDistance * InvCellSize);
+
+		for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+		{
+			if (Ring == 0)
+			{
+				ScanCell(Center, Location, BestDistSq, BestID);
+			}
+			else
+			{
+				// Top and bottom rows of the ring, then the left/right columns between them
+				for (int32 X = -Ring; X <= Ring; ++X)
+				{
+					ScanCell(FIntPoint(Center.X + X, Center.Y - Ring), Location, BestDistSq, BestID);
+					ScanCell(FIntPoint(Center.X + X, Center.Y + Ring), Location, BestDistSq, BestID);
+				}
+				for (int32 Y = -Ring + 1; Y <= Ring - 1; ++Y)
+				{
+					ScanCell(FIntPoint(Center.X - Ring, Center.Y + Y), Location, BestDistSq, BestID);
+					ScanCell(FIntPoint(Center.X + Ring, Center.Y + Y), Location, BestDistSq, BestID);
+				}
+			}
+
+			// Every cell in the next ring is at least Ring * CellSize away
+			if (BestID != INDEX_NONE)
+			{
+				const float NextRingMinDist = Ring * CellSize;
+				if (BestDistSq <= NextRingMinDist * NextRingMinDist)
+				{
+					break;
+				}
+			}
+		}
+	}
+
+	if (OutDistSq)
+	{
+		*OutDistSq = BestDistSq;
+	}
+
+	return BestID;
+}
+
+void FGroundItemSpatialGrid::FindNearestBatch(TArrayView<FNearestQuery> Queries) const
+{
+	// Cell -> queries whose radius bounds overlap it
+	TMap<FIntPoint, TArray<int32, TInlineAllocator<4>>> CellQueries;
+
+	for (int32 QueryIndex = 0; QueryIndex < Queries.Num(); ++QueryIndex)
+	{
+		FNearestQuery& Query = Queries[QueryIndex];
+		Query.ResultID = INDEX_NONE;
+		Query.ResultDistSq = Query.MaxDistance * Query.MaxDistance;
+
+		const FVector Extent(Query.MaxDistance, Query.MaxDistance, 0.0f);
+		const FIntPoint MinCell = GetCellCoord(Query.Location - Extent);
+		const FIntPoint MaxCell = GetCellCoord(Query.Location + Extent);
+
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+			{
+				const FIntPoint CellCoord(X, Y);
+				if (Cells.Contains(CellCoord))
+				{
+					CellQueries.FindOrAdd(CellCoord).Add(QueryIndex);
+				}
+			}
+		}
+	}
+
+	for (const TPair<FIntPoint, TArray<int32, TInlineAllocator<4>>>& Pair : CellQueries)
+	{
+		const FCell& Cell = Cells.FindChecked(Pair.Key);
+
+		for (int32 i = 0; i < Cell.ItemIDs.Num(); ++i)
+		{
+			const FVector& ItemLocation = Cell.Locations[i];
+
+			for (int32 QueryIndex : Pair.Value)
+			{
+				FNearestQuery& Query = Queries[QueryIndex];
+				const float DistSq = FVector::DistSquared(Query.Location, ItemLocation);
+				if (DistSq < Query.ResultDistSq)
+				{
+					Query.ResultDistSq = DistSq;
+					Query.ResultID = Cell.ItemIDs[i];
+				}
+			}
+		}
+	}
+}
+
+void FGroundItemSpatialGrid::ScanCell(const FIntPoint& CellCoord, const FVector& Location, float& InOutBestDistSq, int32& InOutBestID) const
+{
+	const FCell* Cell = Cells.Find(CellCoord);
+	if (!Cell)
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < Cell->ItemIDs.Num(); ++i)
+	{
+		const float DistSq = FVector::DistSquared(Location, Cell->Locations[i]);
+		if (DistSq < InOutBestDistSq)
+		{
+			InOutBestDistSq = DistSq;
+			InOutBestID = Cell->ItemIDs[i];
+		}
+	}
+}
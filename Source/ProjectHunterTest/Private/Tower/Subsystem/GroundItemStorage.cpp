@@ -0,0 +1,149 @@
+// Tower/Subsystem/GroundItemStorage.cpp
+
+#include "Tower/Subsystem/GroundItemStorage.h"
+#include "Item/ItemInstance.h"
+
+// ═══════════════════════════════════════════════════════════════════════
+// MUTATION
+// ═══════════════════════════════════════════════════════════════════════
+
+int32 FGroundItemStorage::Add(int32 ItemID, UItemInstance* Item, const FVector& Location, const FRotator& Rotation, const FGroundItemISMData& ISMSlot, float SpawnTime)
+{
+	check(ItemID >= 0);
+	checkf(!Contains(ItemID), TEXT("FGroundItemStorage: ID %d already stored"), ItemID);
+
+	const int32 DenseIndex = IDs.Add(ItemID);
+	Generations.Add(++NextGeneration);
+	Locations.Add(Location);
+	Rotations.Add(Rotation);
+	Items.Add(Item);
+	ISMSlots.Add(ISMSlot);
+	SpawnTimes.Add(SpawnTime);
+	Rarities.Add(EItemRarity::IR_None);
+	EvictionValues.Add(0);
+	MemoryEstimates.Add(0);
+
+	SetSparse(ItemID, DenseIndex);
+	PageLiveCounts[ItemID >> PageShift]++;
+
+	return DenseIndex;
+}
+
+bool FGroundItemStorage::Remove(int32 ItemID)
+{
+	const int32 DenseIndex = FindIndex(ItemID);
+	if (DenseIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// Patch the entry that will be swapped into the hole
+	const int32 LastIndex = IDs.Num() - 1;
+	if (DenseIndex != LastIndex)
+	{
+		SetSparse(IDs[LastIndex], DenseIndex);
+	}
+
+	IDs.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	Generations.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	Locations.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	Rotations.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	Items.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	ISMSlots.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	SpawnTimes.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	Rarities.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	EvictionValues.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+	MemoryEstimates.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+
+	const int32 Page = ItemID >> PageShift;
+	SparsePages[Page][ItemID & PageMask] = INDEX_NONE;
+
+	if (--PageLiveCounts[Page] == 0)
+	{
+		SparsePages[Page].Empty();
+	}
+
+	return true;
+}
+
+void FGroundItemStorage::Reset()
+{
+	IDs.Reset();
+	Generations.Reset();
+	Locations.Reset();
+	Rotations.Reset();
+	Items.Reset();
+	ISMSlots.Reset();
+	SpawnTimes.Reset();
+	Rarities.Reset();
+	EvictionValues.Reset();
+	MemoryEstimates.Reset();
+
+	SparsePages.Empty();
+	PageLiveCounts.Empty();
+}
+
+SIZE_T FGroundItemStorage::GetAllocatedSize() const
+{
+	SIZE_T Size = IDs.GetAllocatedSize()
+		+ Generations.GetAllocatedSize()
+		+ Locations.GetAllocatedSize()
+		+ Rotations.GetAllocatedSize()
+		+ Items.GetAllocatedSize()
+		+ ISMSlots.GetAllocatedSize()
+		+ SpawnTimes.GetAllocatedSize()
+		+ Rarities.GetAllocatedSize()
+		+ EvictionValues.GetAllocatedSize()
+		+ MemoryEstimates.GetAllocatedSize()
+		+ SparsePages.GetAllocatedSize()
+		+ PageLiveCounts.GetAllocatedSize();
+
+	for (const TArray<int32>& Page : SparsePages)
+	{
+		Size += Page.GetAllocatedSize();
+	}
+
+	return Size;
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// LOOKUP
+// ═══════════════════════════════════════════════════════════════════════
+
+int32 FGroundItemStorage::FindIndex(int32 ItemID) const
+{
+	if (ItemID < 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Page = ItemID >> PageShift;
+	if (!SparsePages.IsValidIndex(Page) || SparsePages[Page].Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	return SparsePages[Page][ItemID & PageMask];
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// SPARSE INDEX
+// ═══════════════════════════════════════════════════════════════════════
+
+void FGroundItemStorage::SetSparse(int32 ItemID, int32 DenseIndex)
+{
+	const int32 Page = ItemID >> PageShift;
+	if (Page >= SparsePages.Num())
+	{
+		SparsePages.SetNum(Page + 1);
+		PageLiveCounts.SetNumZeroed(Page + 1);
+	}
+
+	TArray<int32>& PageData = SparsePages[Page];
+	if (PageData.Num() == 0)
+	{
+		PageData.Init(INDEX_NONE, PageSize);
+	}
+
+	PageData[ItemID & PageMask] = DenseIndex;
+}
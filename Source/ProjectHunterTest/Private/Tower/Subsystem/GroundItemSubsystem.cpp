@@ -2,10 +2,16 @@
 
 #include "Tower/Subsystem/GroundItemSubsystem.h"
 #include "Tower/Actors/ISMContainerActor.h"
+#include "Tower/Subsystem/GroundItemFloorCache.h"
 #include "Item/ItemInstance.h"
 #include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/GameInstance.h"
 #include "Components/InstancedStaticMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "DrawDebugHelpers.h"
+#include "Engine/DataTable.h"
+#include "Item/Library/ItemStructs.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogGroundItemSubsystem, Log, All);
 DEFINE_LOG_CATEGORY(LogGroundItemSubsystem);
@@ -19,12 +25,43 @@ void UGroundItemSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	Super::Initialize(Collection);
 	
 	bIsProcessingRemoval = false;
+
+	Replicator.Initialize(GetWorld());
 	
 	UE_LOG(LogGroundItemSubsystem, Log, TEXT("GroundItemSubsystem: Initialized"));
 }
 
+void UGroundItemSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	UGameInstance* GameInstance = InWorld.GetGameInstance();
+	UGroundItemFloorCache* FloorCache = GameInstance ? GameInstance->GetSubsystem<UGroundItemFloorCache>() : nullptr;
+
+	// Latch now - the cache's next key may change before this world tears down
+	ActiveFloorKey = FloorCache ? FloorCache->GetNextFloorKey() : NAME_None;
+	if (ActiveFloorKey.IsNone())
+	{
+		// Fallback: one slot per map, shared by every floor built on it
+		ActiveFloorKey = FName(*UWorld::RemovePIEPrefix(InWorld.GetOutermost()->GetName()));
+	}
+
+	if (!bPersistFloorItems || !InWorld.IsGameWorld() || InWorld.GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	TArray<uint8> Bytes;
+	if (FloorCache && FloorCache->TakeFloor(ActiveFloorKey, Bytes))
+	{
+		RestoreSnapshot(Bytes);
+	}
+}
+
 void UGroundItemSubsystem::Deinitialize()
 {
+	StoreFloorSnapshot();
+
 	ClearAllItems();
 	
 	if (ISMContainerActor)
@@ -38,6 +75,51 @@ void UGroundItemSubsystem::Deinitialize()
 	UE_LOG(LogGroundItemSubsystem, Log, TEXT("GroundItemSubsystem: Deinitialized"));
 }
 
+void UGroundItemSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Before the flush so restored items get instanced this frame
+	if (ActiveRestore)
+	{
+		ProcessSnapshotRestore(RestoreBudgetMs / 1000.0);
+	}
+
+	// Despawn first so items leaving this frame never get an ISM instance
+	ProcessLifetimes();
+
+	if (PredictedRemovals.Num() > 0)
+	{
+		ExpirePredictedRemovals();
+	}
+
+	if (bCapCheckPending)
+	{
+		EnforceCaps();
+	}
+
+	FlushPendingInstances();
+
+	if (EmptyISMCandidates.Num() > 0)
+	{
+		ReleaseEmptyISMs();
+	}
+
+	TimeSincePileUpdate += DeltaTime;
+	if (TimeSincePileUpdate >= PileUpdateInterval)
+	{
+		TimeSincePileUpdate = 0.0f;
+		UpdatePileLOD();
+	}
+
+	TimeSinceProximityBatch += DeltaTime;
+	if (TimeSinceProximityBatch >= ProximityBatchInterval && ProximityQueries.Num() > 0)
+	{
+		TimeSinceProximityBatch = 0.0f;
+		ProcessProximityQueries();
+	}
+}
+
 // ═══════════════════════════════════════════════════════════════════════
 // ISM MANAGEMENT
 // ═══════════════════════════════════════════════════════════════════════
@@ -84,17 +166,21 @@ void UGroundItemSubsystem::EnsureISMContainerExists()
 	}
 }
 
-UInstancedStaticMeshComponent* UGroundItemSubsystem::GetOrCreateISMComponent(UStaticMesh* Mesh)
+UInstancedStaticMeshComponent* UGroundItemSubsystem::GetOrCreateISMComponent(UStaticMesh* Mesh, const FVector& Location)
 {
 	if (!Mesh)
 	{
 		return nullptr;
 	}
 
-	if (UInstancedStaticMeshComponent** FoundISM = MeshToISM.Find(Mesh))
+	const FGroundItemISMKey Key(GetISMCell(Location), Mesh);
+
+	if (UInstancedStaticMeshComponent** FoundISM = CellISMs.Find(Key))
 	{
 		if (*FoundISM && IsValid(*FoundISM))
 		{
+			// Reused before the release pass - keep it
+			EmptyISMCandidates.Remove(*FoundISM);
 			return *FoundISM;
 		}
 	}
@@ -106,45 +192,179 @@ UInstancedStaticMeshComponent* UGroundItemSubsystem::GetOrCreateISMComponent(USt
 		return nullptr;
 	}
 
-	UInstancedStaticMeshComponent* NewISM = NewObject<UInstancedStaticMeshComponent>(
-		ISMContainerActor,
-		*FString::Printf(TEXT("ISM_%s"), *Mesh->GetName())
-	);
+	UClass* ISMClass = bUseHierarchicalISM
+		? UHierarchicalInstancedStaticMeshComponent::StaticClass()
+		: UInstancedStaticMeshComponent::StaticClass();
+
+	// Unique name - a released partition for the same key may not be collected yet
+	const FName ISMName = MakeUniqueObjectName(ISMContainerActor, ISMClass,
+		*FString::Printf(TEXT("ISM_%s_%d_%d"), *Mesh->GetName(), Key.Cell.X, Key.Cell.Y));
+
+	UInstancedStaticMeshComponent* NewISM = NewObject<UInstancedStaticMeshComponent>(ISMContainerActor, ISMClass, ISMName);
 	
 	NewISM->SetStaticMesh(Mesh);
+	NewISM->SetRemoveSwap();
+	ApplyCullDistance(NewISM, Key.Cell);
+
 	NewISM->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
 	NewISM->SetCollisionResponseToAllChannels(ECR_Ignore);
 	NewISM->SetCollisionResponseToChannel(ECC_Visibility, ECR_Block);
+
+	// New partition inside a pile - stays hidden until the cell expands
+	if (CollapsedCells.Contains(Key.Cell))
+	{
+		SetPartitionCollapsed(NewISM, true);
+	}
 	NewISM->RegisterComponent();
 	NewISM->AttachToComponent(ISMContainerActor->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
 
-	MeshToISM.Add(Mesh, NewISM);
+	CellISMs.Add(Key, NewISM);
+	ISMKeys.Add(NewISM, Key);
+	ISMInstanceItemIDs.FindOrAdd(NewISM).Reset();
 
-	UE_LOG(LogGroundItemSubsystem, Log, TEXT("Created ISM component for mesh: %s"), *Mesh->GetName());
+	UE_LOG(LogGroundItemSubsystem, Verbose, TEXT("Created ISM partition for mesh %s in cell %s"), *Mesh->GetName(), *Key.Cell.ToString());
 
 	return NewISM;
 }
 
-void UGroundItemSubsystem::ReindexAfterRemoval(UInstancedStaticMeshComponent* ISMComponent, int32 RemovedIndex)
+bool UGroundItemSubsystem::RemoveISMInstance(UInstancedStaticMeshComponent* ISM, int32 InstanceIndex)
 {
-	
-	for (TPair<int32, FGroundItemISMData>& Pair : ItemISMData)
+	TArray<int32>* Reverse = ISMInstanceItemIDs.Find(ISM);
+	if (!Reverse || !Reverse->IsValidIndex(InstanceIndex) || InstanceIndex >= ISM->GetInstanceCount())
 	{
-		FGroundItemISMData& Data = Pair.Value;
-		
-		if (Data.ISMComponent != ISMComponent)
+		return false;
+	}
+
+	ISM->RemoveInstance(InstanceIndex);
+
+	// Swap-remove: the last instance now lives at InstanceIndex
+	const int32 LastIndex = Reverse->Num() - 1;
+	if (InstanceIndex != LastIndex)
+	{
+		const int32 MovedItemID = (*Reverse)[LastIndex];
+		(*Reverse)[InstanceIndex] = MovedItemID;
+
+		const int32 MovedIndex = Storage.FindIndex(MovedItemID);
+		if (MovedIndex != INDEX_NONE)
+		{
+			Storage.ISMSlots[MovedIndex].InstanceIndex = InstanceIndex;
+		}
+	}
+
+	Reverse->Pop(EAllowShrinking::No);
+
+	if (Reverse->Num() == 0)
+	{
+		EmptyISMCandidates.Add(ISM);
+	}
+
+	return true;
+}
+
+void UGroundItemSubsystem::RemoveISMInstances(UInstancedStaticMeshComponent* ISM, const TArray<int32>& InstanceIndices)
+{
+	TArray<int32>* Reverse = ISMInstanceItemIDs.Find(ISM);
+	if (!Reverse || InstanceIndices.Num() == 0)
+	{
+		return;
+	}
+
+	ISM->RemoveInstances(InstanceIndices, true);
+
+	// Replay the same descending swap-removes on the reverse index.
+	// Descending order guarantees the moved (last) instance is never one still pending removal.
+	for (int32 InstanceIndex : InstanceIndices)
+	{
+		const int32 LastIndex = Reverse->Num() - 1;
+		if (InstanceIndex != LastIndex)
+		{
+			const int32 MovedItemID = (*Reverse)[LastIndex];
+			(*Reverse)[InstanceIndex] = MovedItemID;
+
+			const int32 MovedIndex = Storage.FindIndex(MovedItemID);
+			if (MovedIndex != INDEX_NONE)
+			{
+				Storage.ISMSlots[MovedIndex].InstanceIndex = InstanceIndex;
+			}
+		}
+
+		Reverse->Pop(EAllowShrinking::No);
+	}
+
+	if (Reverse->Num() == 0)
+	{
+		EmptyISMCandidates.Add(ISM);
+	}
+}
+
+FIntPoint UGroundItemSubsystem::GetISMCell(const FVector& Location) const
+{
+	const float CellSize = FMath::Max(ISMCellSize, 100.0f);
+	return FIntPoint(
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize));
+}
+
+void UGroundItemSubsystem::ApplyCullDistance(UInstancedStaticMeshComponent* ISM, const FIntPoint& Cell) const
+{
+	const float* Override = CellCullDistances.Find(Cell);
+	const float CullDistance = Override ? *Override : ISMCullDistance;
+
+	// Fade over the last 10%; 0 disables culling
+	const int32 EndCull = FMath::Max(0, FMath::RoundToInt(CullDistance));
+	ISM->SetCullDistances(FMath::RoundToInt(EndCull * 0.9f), EndCull);
+
+	// Component-level cull (whole partition skipped on the CPU) - pad by the cell diagonal
+	ISM->SetCullDistance(EndCull > 0 ? EndCull + ISMCellSize * UE_SQRT_2 : 0.0f);
+}
+
+void UGroundItemSubsystem::SetCellCullDistance(FVector Location, float CullDistance)
+{
+	const FIntPoint Cell = GetISMCell(Location);
+
+	if (CullDistance < 0.0f)
+	{
+		CellCullDistances.Remove(Cell);
+	}
+	else
+	{
+		CellCullDistances.Add(Cell, CullDistance);
+	}
+
+	for (const TPair<FGroundItemISMKey, UInstancedStaticMeshComponent*>& Pair : CellISMs)
+	{
+		if (Pair.Key.Cell == Cell && IsValid(Pair.Value))
+		{
+			ApplyCullDistance(Pair.Value, Cell);
+		}
+	}
+}
+
+void UGroundItemSubsystem::ReleaseEmptyISMs()
+{
+	for (UInstancedStaticMeshComponent* ISM : EmptyISMCandidates)
+	{
+		const TArray<int32>* Reverse = ISMInstanceItemIDs.Find(ISM);
+		if (Reverse && Reverse->Num() > 0)
 		{
 			continue;
 		}
 
-		if (Data.InstanceIndex > RemovedIndex)
+		FGroundItemISMKey Key;
+		if (ISMKeys.RemoveAndCopyValue(ISM, Key))
+		{
+			CellISMs.Remove(Key);
+		}
+
+		ISMInstanceItemIDs.Remove(ISM);
+
+		if (IsValid(ISM))
 		{
-			Data.InstanceIndex--;
-			
-			UE_LOG(LogGroundItemSubsystem, Verbose, TEXT("ReindexAfterRemoval: Item %d index shifted from %d to %d"),
-				Pair.Key, Data.InstanceIndex + 1, Data.InstanceIndex);
+			ISM->DestroyComponent();
 		}
 	}
+
+	EmptyISMCandidates.Reset();
 }
 
 // ═══════════════════════════════════════════════════════════════════════
@@ -161,6 +381,43 @@ int32 UGroundItemSubsystem::AddItemToGround(UItemInstance* Item, FVector Locatio
 		return -1;
 	}
 
+	return AddItemToGroundInternal(Item, Location, Rotation);
+}
+
+TArray<int32> UGroundItemSubsystem::AddItemsToGround(const TArray<UItemInstance*>& Items, const TArray<FVector>& Locations)
+{
+	TArray<int32> ItemIDs;
+	ItemIDs.Init(-1, Items.Num());
+
+	if (Items.Num() != Locations.Num())
+	{
+		UE_LOG(LogGroundItemSubsystem, Error, TEXT("AddItemsToGround: %d items but %d locations"), Items.Num(), Locations.Num());
+		return ItemIDs;
+	}
+
+	EnsureISMContainerExists();
+
+	if (!ISMContainerActor)
+	{
+		UE_LOG(LogGroundItemSubsystem, Error, TEXT("AddItemsToGround: Cannot add items - no container actor!"));
+		return ItemIDs;
+	}
+
+	PendingInstances.Reserve(PendingInstances.Num() + Items.Num());
+
+	for (int32 i = 0; i < Items.Num(); ++i)
+	{
+		ItemIDs[i] = AddItemToGroundInternal(Items[i], Locations[i], FRotator::ZeroRotator);
+	}
+
+	UE_LOG(LogGroundItemSubsystem, Verbose, TEXT("AddItemsToGround: Queued %d items"), Items.Num());
+
+	return ItemIDs;
+}
+
+int32 UGroundItemSubsystem::AddItemToGroundInternal(UItemInstance* Item, const FVector& Location, const FRotator& Rotation,
+	int32 ForcedItemID, float InitialAge)
+{
 	if (!Item || !Item->HasValidBaseData())
 	{
 		UE_LOG(LogGroundItemSubsystem, Warning, TEXT("AddItemToGround: Invalid item!"));
@@ -174,34 +431,124 @@ int32 UGroundItemSubsystem::AddItemToGround(UItemInstance* Item, FVector Locatio
 		return -1;
 	}
 
-	UInstancedStaticMeshComponent* ISM = GetOrCreateISMComponent(Mesh);
+	UInstancedStaticMeshComponent* ISM = GetOrCreateISMComponent(Mesh, Location);
 	if (!ISM)
 	{
 		UE_LOG(LogGroundItemSubsystem, Error, TEXT("AddItemToGround: Failed to get/create ISM component!"));
 		return -1;
 	}
 
-	FTransform Transform(Rotation, Location, FVector::OneVector);
-	int32 ISMInstanceIndex = ISM->AddInstance(Transform);
+	const int32 ItemID = (ForcedItemID >= 0 && !Storage.Contains(ForcedItemID)) ? ForcedItemID : NextItemID++;
+	NextItemID = FMath::Max(NextItemID, ItemID + 1);
+
+	const float Now = GetWorld()->GetTimeSeconds();
+
+	// Instance index is assigned by FlushPendingInstances
+	const int32 DenseIndex = Storage.Add(ItemID, Item, Location, Rotation, FGroundItemISMData(ISM, INDEX_NONE, Mesh), Now - InitialAge);
+	Storage.EvictionValues[DenseIndex] = Item->GetCalculatedValue();
+	Storage.MemoryEstimates[DenseIndex] = EstimateItemMemory(Item);
+	TotalMemoryEstimate += Storage.MemoryEstimates[DenseIndex];
+	Storage.Rarities[DenseIndex] = Item->Rarity;
+
+	ItemToID.Add(Item, ItemID);
+	SpatialGrid.Add(ItemID, Location);
 
-	if (ISMInstanceIndex == INDEX_NONE)
+	if (Replicator.IsActive())
 	{
-		UE_LOG(LogGroundItemSubsystem, Error, TEXT("AddItemToGround: Failed to add instance to ISM!"));
-		return -1;
+		Replicator.AddItem(ItemID, Item, Location, Rotation);
+	}
+
+	const float Lifetime = LifetimeSettings.GetLifetime(Item->Rarity);
+	if (Lifetime > 0.0f)
+	{
+		// Overdue restored items still get one tick so they leave through the normal despawn path
+		LifetimeWheel.Schedule(ItemID, Storage.Generations[DenseIndex], Now, FMath::Max(Lifetime - InitialAge, 0.0f));
 	}
 
-	int32 ItemID = NextItemID++;
+	bCapCheckPending = true;
 
-	GroundItems.Add(ItemID, Item);
-	InstanceLocations.Add(ItemID, Location);
-	ItemISMData.Add(ItemID, FGroundItemISMData(ISM, ISMInstanceIndex, Mesh));
+	PendingInstances.Add(ItemID);
 
-	UE_LOG(LogGroundItemSubsystem, Log, TEXT("AddItemToGround: Added item '%s' (ID: %d, ISMIndex: %d) at %s"), 
-		*Item->GetDisplayName().ToString(), ItemID, ISMInstanceIndex, *Location.ToString());
+	// OPTIMIZATION: No display name formatting on the hot path
+	UE_LOG(LogGroundItemSubsystem, Verbose, TEXT("AddItemToGround: Queued item ID %d at %s"), ItemID, *Location.ToString());
+
+	OnGroundItemAdded.Broadcast(ItemID, Location);
 
 	return ItemID;
 }
 
+void UGroundItemSubsystem::FlushPendingInstances()
+{
+	if (PendingInstances.Num() == 0)
+	{
+		return;
+	}
+
+	// Group by ISM so each component gets exactly one AddInstances call
+	TMap<UInstancedStaticMeshComponent*, TArray<int32>> IDsByISM;
+	TMap<UInstancedStaticMeshComponent*, TArray<FTransform>> TransformsByISM;
+
+	for (int32 PendingID : PendingInstances)
+	{
+		const int32 DenseIndex = Storage.FindIndex(PendingID);
+		if (DenseIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		UInstancedStaticMeshComponent* ISM = Storage.ISMSlots[DenseIndex].ISMComponent;
+		if (!IsValid(ISM))
+		{
+			continue;
+		}
+
+		IDsByISM.FindOrAdd(ISM).Add(PendingID);
+		TransformsByISM.FindOrAdd(ISM).Emplace(Storage.Rotations[DenseIndex], Storage.Locations[DenseIndex], FVector::OneVector);
+	}
+
+	PendingInstances.Reset();
+
+	for (TPair<UInstancedStaticMeshComponent*, TArray<int32>>& Pair : IDsByISM)
+	{
+		UInstancedStaticMeshComponent* ISM = Pair.Key;
+		const TArray<int32>& ItemIDs = Pair.Value;
+
+		TArray<int32> NewIndices = ISM->AddInstances(TransformsByISM.FindChecked(ISM), true, false, false);
+		if (NewIndices.Num() != ItemIDs.Num())
+		{
+			UE_LOG(LogGroundItemSubsystem, Error, TEXT("FlushPendingInstances: ISM returned %d indices for %d instances"),
+				NewIndices.Num(), ItemIDs.Num());
+			continue;
+		}
+
+		TArray<int32>& Reverse = ISMInstanceItemIDs.FindOrAdd(ISM);
+		for (int32 i = 0; i < ItemIDs.Num(); ++i)
+		{
+			ensureMsgf(NewIndices[i] == Reverse.Num(), TEXT("FlushPendingInstances: ISM reverse index out of sync"));
+			Reverse.Add(ItemIDs[i]);
+
+			Storage.ISMSlots[Storage.FindIndex(ItemIDs[i])].InstanceIndex = NewIndices[i];
+		}
+	}
+}
+
+bool UGroundItemSubsystem::CancelPendingInstance(int32 ItemID)
+{
+	if (PendingInstances.Remove(ItemID) == 0)
+	{
+		return false;
+	}
+
+	// The partition may have been created for this item alone
+	const int32 DenseIndex = Storage.FindIndex(ItemID);
+	if (DenseIndex != INDEX_NONE && Storage.ISMSlots[DenseIndex].ISMComponent)
+	{
+		EmptyISMCandidates.Add(Storage.ISMSlots[DenseIndex].ISMComponent);
+	}
+
+	return true;
+}
+
 UItemInstance* UGroundItemSubsystem::RemoveItemFromGround(int32 ItemID)
 {
 	// ═══════════════════════════════════════════════
@@ -234,27 +581,26 @@ UItemInstance* UGroundItemSubsystem::RemoveItemFromGround(int32 ItemID)
 
 UItemInstance* UGroundItemSubsystem::RemoveItemFromGroundInternal(int32 ItemID)
 {
-	UItemInstance** FoundItem = GroundItems.Find(ItemID);
-	if (!FoundItem)
+	const int32 DenseIndex = Storage.FindIndex(ItemID);
+	if (DenseIndex == INDEX_NONE)
 	{
 		UE_LOG(LogGroundItemSubsystem, Warning, TEXT("RemoveItemFromGround: Item ID %d not found"), ItemID);
 		return nullptr;
 	}
 
-	UItemInstance* Item = *FoundItem;
-
-	FGroundItemISMData* ISMData = ItemISMData.Find(ItemID);
-	if (ISMData && ISMData->IsValid())
+	const FGroundItemISMData& ISMData = Storage.ISMSlots[DenseIndex];
+	if (ISMData.InstanceIndex == INDEX_NONE && CancelPendingInstance(ItemID))
+	{
+		// Never got an ISM instance - nothing to remove from the component
+	}
+	else if (ISMData.IsValid())
 	{
-		UInstancedStaticMeshComponent* ISM = ISMData->ISMComponent;
-		int32 InstanceIndex = ISMData->InstanceIndex;
+		UInstancedStaticMeshComponent* ISM = ISMData.ISMComponent;
+		int32 InstanceIndex = ISMData.InstanceIndex;
 
-		if (InstanceIndex >= 0 && InstanceIndex < ISM->GetInstanceCount())
+		if (RemoveISMInstance(ISM, InstanceIndex))
 		{
-			ISM->RemoveInstance(InstanceIndex);
-			ReindexAfterRemoval(ISM, InstanceIndex);
-			
-			UE_LOG(LogGroundItemSubsystem, Log, TEXT("RemoveItemFromGround: Removed item ID %d (ISMIndex was %d)"), 
+			UE_LOG(LogGroundItemSubsystem, Verbose, TEXT("RemoveItemFromGround: Removed item ID %d (ISMIndex was %d)"), 
 				ItemID, InstanceIndex);
 		}
 		else
@@ -269,9 +615,33 @@ UItemInstance* UGroundItemSubsystem::RemoveItemFromGroundInternal(int32 ItemID)
 		UE_LOG(LogGroundItemSubsystem, Warning, TEXT("RemoveItemFromGround: No valid ISM data for item ID %d"), ItemID);
 	}
 
-	GroundItems.Remove(ItemID);
-	InstanceLocations.Remove(ItemID);
-	ItemISMData.Remove(ItemID);
+	return RemoveItemRecord(ItemID);
+}
+
+UItemInstance* UGroundItemSubsystem::RemoveItemRecord(int32 ItemID)
+{
+	const int32 DenseIndex = Storage.FindIndex(ItemID);
+	if (DenseIndex == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	UItemInstance* Item = Storage.Items[DenseIndex];
+	TotalMemoryEstimate -= Storage.MemoryEstimates[DenseIndex];
+
+	if (Replicator.IsActive())
+	{
+		Replicator.RemoveItem(ItemID, Storage.Locations[DenseIndex]);
+	}
+
+	const FVector Location = Storage.Locations[DenseIndex];
+
+	ReplicatedItems.Remove(ItemID);
+	SpatialGrid.Remove(ItemID, Location);
+	ItemToID.Remove(Item);
+	Storage.Remove(ItemID);
+
+	OnGroundItemRemoved.Broadcast(ItemID, Location);
 
 	return Item;
 }
@@ -292,24 +662,51 @@ TArray<UItemInstance*> UGroundItemSubsystem::RemoveMultipleItemsFromGround(const
 	
 	bIsProcessingRemoval = true;
 	
-	// Sort by ISM index descending for efficient removal
-	TArray<TPair<int32, int32>> SortedItems;
+	// Group instance indices per ISM (one RemoveInstances call each)
+	TMap<UInstancedStaticMeshComponent*, TArray<int32>> IndicesByISM;
+	TArray<int32> ValidIDs;
+	ValidIDs.Reserve(ItemIDs.Num());
+	TSet<int32> SeenIDs;
+	SeenIDs.Reserve(ItemIDs.Num());
+
 	for (int32 ItemID : ItemIDs)
 	{
-		if (FGroundItemISMData* Data = ItemISMData.Find(ItemID))
+		bool bAlreadySeen = false;
+		SeenIDs.Add(ItemID, &bAlreadySeen);
+		const int32 DenseIndex = Storage.FindIndex(ItemID);
+		if (bAlreadySeen || DenseIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		ValidIDs.Add(ItemID);
+
+		const FGroundItemISMData& Data = Storage.ISMSlots[DenseIndex];
+		if (Data.IsValid())
+		{
+			IndicesByISM.FindOrAdd(Data.ISMComponent).Add(Data.InstanceIndex);
+		}
+		else
 		{
-			SortedItems.Add(TPair<int32, int32>(ItemID, Data->InstanceIndex));
+			CancelPendingInstance(ItemID);
 		}
 	}
 	
-	SortedItems.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B)
+	for (TPair<UInstancedStaticMeshComponent*, TArray<int32>>& Pair : IndicesByISM)
 	{
-		return A.Value > B.Value;
-	});
+		if (!IsValid(Pair.Key))
+		{
+			continue;
+		}
+
+		// Descending order for swap-remove replay
+		Pair.Value.Sort(TGreater<int32>());
+		RemoveISMInstances(Pair.Key, Pair.Value);
+	}
 	
-	for (const TPair<int32, int32>& Pair : SortedItems)
+	for (int32 ItemID : ValidIDs)
 	{
-		if (UItemInstance* Item = RemoveItemFromGroundInternal(Pair.Key))
+		if (UItemInstance* Item = RemoveItemRecord(ItemID))
 		{
 			RemovedItems.Add(Item);
 		}
@@ -326,133 +723,982 @@ TArray<UItemInstance*> UGroundItemSubsystem::RemoveMultipleItemsFromGround(const
 
 UItemInstance* UGroundItemSubsystem::GetItemByID(int32 ItemID) const
 {
-	UItemInstance* const* FoundItem = GroundItems.Find(ItemID);
-	return FoundItem ? *FoundItem : nullptr;
+	const int32 DenseIndex = Storage.FindIndex(ItemID);
+	return DenseIndex != INDEX_NONE ? Storage.Items[DenseIndex].Get() : nullptr;
 }
 
-UItemInstance* UGroundItemSubsystem::GetNearestItem(FVector Location, float MaxDistance, int32& OutItemID)
+bool UGroundItemSubsystem::GetItemDisplayInfo(int32 ItemID, FText& OutName, int32& OutQuantity) const
 {
-	OutItemID = -1;
-	float ClosestDistSq = MaxDistance * MaxDistance;
-	UItemInstance* ClosestItem = nullptr;
+	const int32 DenseIndex = Storage.FindIndex(ItemID);
+	if (DenseIndex == INDEX_NONE)
+	{
+		return false;
+	}
 
-	for (const TPair<int32, FVector>& Pair : InstanceLocations)
+	if (UItemInstance* Item = Storage.Items[DenseIndex].Get())
 	{
-		float DistSq = FVector::DistSquared(Location, Pair.Value);
-		
-		if (DistSq < ClosestDistSq)
-		{
-			ClosestDistSq = DistSq;
-			OutItemID = Pair.Key;
-			
-			if (UItemInstance* const* Item = GroundItems.Find(Pair.Key))
-			{
-				ClosestItem = *Item;
-			}
-		}
+		OutName = Item->GetDisplayName();
+		OutQuantity = Item->Quantity;
+		return true;
+	}
+
+	// Client: base row from the owning cell's palette
+	const FReplicatedItem* Replicated = ReplicatedItems.Find(ItemID);
+	const FItemBase* Base = Replicated ? GetReplicatedBaseRow(*Replicated) : nullptr;
+	if (!Base)
+	{
+		return false;
 	}
 
-	return ClosestItem;
+	OutName = Base->ItemName;
+	OutQuantity = Replicated->Entry.Quantity;
+	return true;
 }
 
-int32 UGroundItemSubsystem::GetItemsInRadius(FVector Location, float Radius, TArray<int32>& OutItemIDs)
+bool UGroundItemSubsystem::GetPredictedItemDisplayInfo(int32 ItemID, FText& OutName, int32& OutQuantity, EItemRarity& OutRarity) const
 {
-	OutItemIDs.Reset();
-	float RadiusSq = Radius * Radius;
-
-	for (const TPair<int32, FVector>& Pair : InstanceLocations)
+	const FPredictedRemoval* Predicted = PredictedRemovals.Find(ItemID);
+	const FItemBase* Base = Predicted ? GetReplicatedBaseRow(Predicted->Source) : nullptr;
+	if (!Base)
 	{
-		float DistSq = FVector::DistSquared(Location, Pair.Value);
-		
-		if (DistSq <= RadiusSq)
-		{
-			OutItemIDs.Add(Pair.Key);
-		}
+		return false;
 	}
 
-	return OutItemIDs.Num();
+	OutName = Base->ItemName;
+	OutQuantity = Predicted->Source.Entry.Quantity;
+	OutRarity = Predicted->Source.Entry.Rarity;
+	return true;
 }
 
-TArray<UItemInstance*> UGroundItemSubsystem::GetItemInstancesInRadius(FVector Location, float Radius)
+const FItemBase* UGroundItemSubsystem::GetReplicatedBaseRow(const FReplicatedItem& Replicated)
 {
-	TArray<UItemInstance*> ItemsInRange;
-	float RadiusSq = Radius * Radius;
+	const AGroundItemNetCell* Cell = Replicated.Cell.Get();
+	const FDataTableRowHandle* BaseHandle = Cell ? Cell->GetBaseItemHandle(Replicated.Entry.BaseIndex) : nullptr;
+	return BaseHandle ? BaseHandle->GetRow<FItemBase>(TEXT("GroundItemDisplayInfo")) : nullptr;
+}
 
-	for (const TPair<int32, FVector>& Pair : InstanceLocations)
+void UGroundItemSubsystem::NotifyItemChanged(int32 ItemID)
+{
+	const int32 DenseIndex = Storage.FindIndex(ItemID);
+	if (DenseIndex != INDEX_NONE && Replicator.IsActive())
 	{
-		float DistSq = FVector::DistSquared(Location, Pair.Value);
-		
-		if (DistSq <= RadiusSq)
-		{
-			if (UItemInstance* const* Found = GroundItems.Find(Pair.Key))
-			{
-				ItemsInRange.Add(*Found);
-			}
-		}
+		Replicator.RefreshItem(ItemID, Storage.Items[DenseIndex].Get(), Storage.Locations[DenseIndex]);
 	}
+}
 
-	return ItemsInRange;
+const FVector* UGroundItemSubsystem::GetItemLocation(int32 ItemID) const
+{
+	const int32 DenseIndex = Storage.FindIndex(ItemID);
+	return DenseIndex != INDEX_NONE ? &Storage.Locations[DenseIndex] : nullptr;
 }
 
-int32 UGroundItemSubsystem::GetInstanceID(UItemInstance* Item) const
+UItemInstance* UGroundItemSubsystem::GetNearestItem(FVector Location, float MaxDistance, int32& OutItemID)
 {
-	if (!Item)
+	OutItemID = SpatialGrid.FindNearest(Location, MaxDistance);
+	if (OutItemID == INDEX_NONE)
 	{
-		return -1;
+		return nullptr;
 	}
 
-	for (const TPair<int32, UItemInstance*>& Pair : GroundItems)
-	{
-		if (Pair.Value == Item)
-		{
-			return Pair.Key;
-		}
-	}
-	
-	return -1;
+	return GetItemByID(OutItemID);
 }
 
-void UGroundItemSubsystem::UpdateItemLocation(int32 ItemID, FVector NewLocation)
+int32 UGroundItemSubsystem::GetItemsInRadius(FVector Location, float Radius, TArray<int32>& OutItemIDs)
 {
-	FGroundItemISMData* ISMData = ItemISMData.Find(ItemID);
-	if (!ISMData || !ISMData->IsValid())
+	OutItemIDs.Reset();
+
+	SpatialGrid.ForEachInRadius(Location, Radius, [&OutItemIDs](int32 ItemID, const FVector&)
 	{
-		UE_LOG(LogGroundItemSubsystem, Warning, TEXT("UpdateItemLocation: No valid ISM data for item ID %d"), ItemID);
+		OutItemIDs.Add(ItemID);
+	});
+
+	return OutItemIDs.Num();
+}
+
+TArray<UItemInstance*> UGroundItemSubsystem::GetItemInstancesInRadius(FVector Location, float Radius)
+{
+	TArray<UItemInstance*> ItemsInRange;
+
+	SpatialGrid.ForEachInRadius(Location, Radius, [this, &ItemsInRange](int32 ItemID, const FVector&)
+	{
+		if (UItemInstance* Item = GetItemByID(ItemID))
+		{
+			ItemsInRange.Add(Item);
+		}
+	});
+
+	return ItemsInRange;
+}
+
+int32 UGroundItemSubsystem::GetItemEntriesInRadius(FVector Location, float Radius, TArray<FGroundItemEntry>& OutEntries)
+{
+	OutEntries.Reset();
+
+	SpatialGrid.ForEachInRadius(Location, Radius, [this, &OutEntries](int32 ItemID, const FVector&)
+	{
+		if (UItemInstance* Item = GetItemByID(ItemID))
+		{
+			OutEntries.Emplace(ItemID, Item);
+		}
+	});
+
+	return OutEntries.Num();
+}
+
+int32 UGroundItemSubsystem::GetInstanceID(UItemInstance* Item) const
+{
+	if (!Item)
+	{
+		return -1;
+	}
+
+	const int32* FoundID = ItemToID.Find(Item);
+	return FoundID ? *FoundID : -1;
+}
+
+void UGroundItemSubsystem::UpdateItemLocation(int32 ItemID, FVector NewLocation)
+{
+	const int32 DenseIndex = Storage.FindIndex(ItemID);
+	if (DenseIndex == INDEX_NONE)
+	{
+		UE_LOG(LogGroundItemSubsystem, Warning, TEXT("UpdateItemLocation: No valid ISM data for item ID %d"), ItemID);
 		return;
 	}
 
-	UInstancedStaticMeshComponent* ISM = ISMData->ISMComponent;
-	int32 InstanceIndex = ISMData->InstanceIndex;
+	if (Replicator.IsActive())
+	{
+		Replicator.MoveItem(ItemID, Storage.Locations[DenseIndex], NewLocation);
+	}
+
+	FGroundItemISMData& ISMData = Storage.ISMSlots[DenseIndex];
+	const bool bChangesPartition = GetISMCell(Storage.Locations[DenseIndex]) != GetISMCell(NewLocation);
+
+	SpatialGrid.Move(ItemID, Storage.Locations[DenseIndex], NewLocation);
+	Storage.Locations[DenseIndex] = NewLocation;
+
+	// Still queued - flush will read the new location (retarget the partition if needed)
+	if (!ISMData.IsValid())
+	{
+		if (bChangesPartition)
+		{
+			// The old partition may have been created for this item alone
+			if (ISMData.ISMComponent)
+			{
+				EmptyISMCandidates.Add(ISMData.ISMComponent);
+			}
+			ISMData.ISMComponent = GetOrCreateISMComponent(ISMData.Mesh, NewLocation);
+		}
+		return;
+	}
+
+	UInstancedStaticMeshComponent* ISM = ISMData.ISMComponent;
+	int32 InstanceIndex = ISMData.InstanceIndex;
 
 	FTransform CurrentTransform;
 	ISM->GetInstanceTransform(InstanceIndex, CurrentTransform, true);
 
+	if (bChangesPartition)
+	{
+		// Leave the old partition, re-queue into the new one
+		UInstancedStaticMeshComponent* NewISM = GetOrCreateISMComponent(ISMData.Mesh, NewLocation);
+		if (NewISM && RemoveISMInstance(ISM, InstanceIndex))
+		{
+			FGroundItemISMData& MovedData = Storage.ISMSlots[DenseIndex];
+			MovedData.ISMComponent = NewISM;
+			MovedData.InstanceIndex = INDEX_NONE;
+
+			PendingInstances.Add(ItemID);
+		}
+		return;
+	}
+
 	FTransform NewTransform = CurrentTransform;
 	NewTransform.SetLocation(NewLocation);
 
 	ISM->UpdateInstanceTransform(InstanceIndex, NewTransform, true);
-
-	InstanceLocations.Add(ItemID, NewLocation);
 }
 
 void UGroundItemSubsystem::ClearAllItems()
 {
-	for (TPair<UStaticMesh*, UInstancedStaticMeshComponent*>& Pair : MeshToISM)
+	for (TPair<FGroundItemISMKey, UInstancedStaticMeshComponent*>& Pair : CellISMs)
 	{
 		if (Pair.Value && IsValid(Pair.Value))
 		{
-			Pair.Value->ClearInstances();
+			Pair.Value->DestroyComponent();
 		}
 	}
 
-	GroundItems.Empty();
-	InstanceLocations.Empty();
-	ItemISMData.Empty();
+	CellISMs.Empty();
+	ISMKeys.Empty();
+	ISMInstanceItemIDs.Empty();
+	EmptyISMCandidates.Empty();
+	ResetPileLOD();
+
+	Storage.Reset();
+	ItemToID.Empty();
+	SpatialGrid.Reset();
+	Replicator.Reset();
+	ReplicatedItems.Empty();
+	PredictedRemovals.Empty();
+
 	PendingRemovals.Empty();
+	PendingInstances.Empty();
+	LifetimeWheel.Reset();
+	TotalMemoryEstimate = 0;
+	bCapCheckPending = false;
+	ActiveRestore.Reset();
 
 	UE_LOG(LogGroundItemSubsystem, Log, TEXT("ClearAllItems: All ground items cleared"));
 }
 
+// ═══════════════════════════════════════════════════════════════════════
+// FLOOR SNAPSHOTS
+// ═══════════════════════════════════════════════════════════════════════
+
+void UGroundItemSubsystem::EnterFloor(FName FloorKey)
+{
+	if (FloorKey.IsNone() || FloorKey == ActiveFloorKey)
+	{
+		return;
+	}
+
+	StoreFloorSnapshot();
+	ClearAllItems();
+
+	ActiveFloorKey = FloorKey;
+
+	const UWorld* World = GetWorld();
+	if (!bPersistFloorItems || !World || World->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	UGameInstance* GameInstance = World->GetGameInstance();
+	UGroundItemFloorCache* FloorCache = GameInstance ? GameInstance->GetSubsystem<UGroundItemFloorCache>() : nullptr;
+
+	TArray<uint8> Bytes;
+	if (FloorCache && FloorCache->TakeFloor(ActiveFloorKey, Bytes))
+	{
+		RestoreSnapshot(Bytes);
+	}
+}
+
+bool UGroundItemSubsystem::SaveSnapshot(TArray<uint8>& OutBytes)
+{
+	OutBytes.Reset();
+
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return false;
+	}
+
+	const float Now = World->GetTimeSeconds();
+
+	TArray<FGroundItemSnapshotRecord> Records;
+	TArray<UItemInstance*> Items;
+	Records.Reserve(Storage.Num());
+	Items.Reserve(Storage.Num());
+
+	for (int32 i = 0; i < Storage.Num(); ++i)
+	{
+		// Replicated client-side entries have no item to save
+		UItemInstance* Item = Storage.Items[i];
+		if (!Item)
+		{
+			continue;
+		}
+
+		FGroundItemSnapshotRecord& Record = Records.AddDefaulted_GetRef();
+		Record.ItemID = Storage.IDs[i];
+		Record.Location = Storage.Locations[i];
+		Record.Yaw = Storage.Rotations[i].Yaw;
+		Record.Age = Now - Storage.SpawnTimes[i];
+
+		Items.Add(Item);
+	}
+
+	if (Records.Num() == 0)
+	{
+		return false;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const bool bSuccess = FGroundItemSnapshot::Write(Records, Items, OutBytes);
+
+	UE_LOG(LogGroundItemSubsystem, Log, TEXT("SaveSnapshot: %d items -> %d bytes (%.2f ms)"),
+		Records.Num(), OutBytes.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	return bSuccess;
+}
+
+bool UGroundItemSubsystem::RestoreSnapshot(const TArray<uint8>& Bytes)
+{
+	TUniquePtr<FGroundItemSnapshot> Restore = MakeUnique<FGroundItemSnapshot>();
+	if (!Restore->Open(TArray<uint8>(Bytes)))
+	{
+		return false;
+	}
+
+	// A second restore queues behind the first by finishing it now
+	FinishRestoreNow();
+
+	// New drops during the restore must not take saved IDs
+	NextItemID = FMath::Max(NextItemID, Restore->GetMaxItemID() + 1);
+	ActiveRestore = MoveTemp(Restore);
+
+	UE_LOG(LogGroundItemSubsystem, Log, TEXT("RestoreSnapshot: Rebuilding %d items over %.1f ms/frame"),
+		ActiveRestore->GetNumItems(), RestoreBudgetMs);
+
+	return true;
+}
+
+void UGroundItemSubsystem::ProcessSnapshotRestore(double BudgetSeconds)
+{
+	EnsureISMContainerExists();
+	if (!ISMContainerActor)
+	{
+		return;
+	}
+
+	TArray<UItemInstance*> Items;
+	TArray<FGroundItemSnapshotRecord> Records;
+	ActiveRestore->ReadItems(BudgetSeconds, Items, Records, this);
+
+	PendingInstances.Reserve(PendingInstances.Num() + Items.Num());
+
+	for (int32 i = 0; i < Items.Num(); ++i)
+	{
+		AddItemToGroundInternal(Items[i], Records[i].Location, FRotator(0.0f, Records[i].Yaw, 0.0f),
+			Records[i].ItemID, Records[i].Age);
+	}
+
+	if (ActiveRestore->IsDone())
+	{
+		UE_LOG(LogGroundItemSubsystem, Log, TEXT("RestoreSnapshot: Done (%d/%d items)"),
+			ActiveRestore->GetNumRead(), ActiveRestore->GetNumItems());
+
+		ActiveRestore.Reset();
+	}
+}
+
+void UGroundItemSubsystem::FinishRestoreNow()
+{
+	while (ActiveRestore)
+	{
+		ProcessSnapshotRestore(UE_BIG_NUMBER);
+
+		// No container (world not playing) - give up rather than spin
+		if (ActiveRestore && !ISMContainerActor)
+		{
+			ActiveRestore.Reset();
+		}
+	}
+}
+
+void UGroundItemSubsystem::StoreFloorSnapshot()
+{
+	const UWorld* World = GetWorld();
+	if (!bPersistFloorItems || ActiveFloorKey.IsNone() || !World || !World->IsGameWorld() || World->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	UGameInstance* GameInstance = World->GetGameInstance();
+	UGroundItemFloorCache* FloorCache = GameInstance ? GameInstance->GetSubsystem<UGroundItemFloorCache>() : nullptr;
+	if (!FloorCache)
+	{
+		return;
+	}
+
+	// Unfinished restore - items still in the blob would otherwise be lost
+	FinishRestoreNow();
+
+	TArray<uint8> Bytes;
+	if (SaveSnapshot(Bytes))
+	{
+		FloorCache->StoreFloor(ActiveFloorKey, MoveTemp(Bytes));
+	}
+	else
+	{
+		// Floor was emptied - don't resurrect an older snapshot next visit
+		FloorCache->ForgetFloor(ActiveFloorKey);
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// PILE LOD
+// ═══════════════════════════════════════════════════════════════════════
+
+void UGroundItemSubsystem::GetViewerLocations(TArray<FVector, TInlineAllocator<4>>& OutLocations) const
+{
+	UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* PC = It->Get();
+		if (!PC || !PC->IsLocalController())
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		OutLocations.Add(ViewLocation);
+	}
+}
+
+void UGroundItemSubsystem::SetPartitionCollapsed(UInstancedStaticMeshComponent* ISM, bool bCollapsed)
+{
+	if (!IsValid(ISM) || ISM->GetVisibleFlag() == !bCollapsed)
+	{
+		return;
+	}
+
+	ISM->SetVisibility(!bCollapsed);
+	ISM->SetCollisionEnabled(bCollapsed ? ECollisionEnabled::NoCollision : ECollisionEnabled::QueryOnly);
+}
+
+void UGroundItemSubsystem::UpdatePileLOD()
+{
+	TArray<FVector, TInlineAllocator<4>> ViewLocations;
+	GetViewerLocations(ViewLocations);
+
+	if (!PileMesh || ViewLocations.Num() == 0)
+	{
+		if (CollapsedCells.Num() > 0)
+		{
+			ResetPileLOD();
+		}
+		return;
+	}
+
+	// Items per partition cell (reverse index sizes - no per-item work)
+	TMap<FIntPoint, int32> CellCounts;
+	for (const TPair<FGroundItemISMKey, UInstancedStaticMeshComponent*>& Pair : CellISMs)
+	{
+		if (const TArray<int32>* Reverse = ISMInstanceItemIDs.Find(Pair.Value))
+		{
+			CellCounts.FindOrAdd(Pair.Key.Cell) += Reverse->Num();
+		}
+	}
+
+	TMap<FIntPoint, int32> NewCollapsed;
+	bool bDirty = false;
+
+	for (const TPair<FIntPoint, int32>& Pair : CellCounts)
+	{
+		const FVector2D CellCenter((Pair.Key.X + 0.5f) * ISMCellSize, (Pair.Key.Y + 0.5f) * ISMCellSize);
+
+		// Nearest viewer decides - a cell next to either split-screen player stays expanded
+		float Distance = MAX_flt;
+		for (const FVector& ViewLocation : ViewLocations)
+		{
+			Distance = FMath::Min(Distance, FVector2D::Distance(CellCenter, FVector2D(ViewLocation)));
+		}
+
+		const int32* WasCollapsed = CollapsedCells.Find(Pair.Key);
+		const float Threshold = WasCollapsed ? PileCollapseDistance - PileHysteresis : PileCollapseDistance;
+
+		if (Pair.Value >= PileMinItems && Distance > Threshold)
+		{
+			NewCollapsed.Add(Pair.Key, Pair.Value);
+			bDirty |= !WasCollapsed || *WasCollapsed != Pair.Value;
+		}
+		else
+		{
+			bDirty |= WasCollapsed != nullptr;
+		}
+	}
+
+	// Collapsed cells that emptied out entirely
+	bDirty |= NewCollapsed.Num() != CollapsedCells.Num();
+
+	if (!bDirty)
+	{
+		return;
+	}
+
+	for (const TPair<FGroundItemISMKey, UInstancedStaticMeshComponent*>& Pair : CellISMs)
+	{
+		SetPartitionCollapsed(Pair.Value, NewCollapsed.Contains(Pair.Key.Cell));
+	}
+
+	CollapsedCells = MoveTemp(NewCollapsed);
+	RebuildPiles();
+}
+
+void UGroundItemSubsystem::RebuildPiles()
+{
+	Piles.Reset();
+
+	// One pile per occupied grid cell inside each collapsed partition
+	TMap<FIntPoint, int32> PileIndexByGridCell;
+	TArray<FVector> LocationSums;
+
+	for (const TPair<FGroundItemISMKey, UInstancedStaticMeshComponent*>& Pair : CellISMs)
+	{
+		if (!CollapsedCells.Contains(Pair.Key.Cell))
+		{
+			continue;
+		}
+
+		const TArray<int32>* Reverse = ISMInstanceItemIDs.Find(Pair.Value);
+		if (!Reverse)
+		{
+			continue;
+		}
+
+		for (int32 ItemID : *Reverse)
+		{
+			const int32 DenseIndex = Storage.FindIndex(ItemID);
+			if (DenseIndex == INDEX_NONE)
+			{
+				continue;
+			}
+
+			const FVector& Location = Storage.Locations[DenseIndex];
+			const FIntPoint GridCell = SpatialGrid.GetCellCoord(Location);
+
+			int32& PileIndex = PileIndexByGridCell.FindOrAdd(GridCell, INDEX_NONE);
+			if (PileIndex == INDEX_NONE)
+			{
+				PileIndex = Piles.AddDefaulted();
+				LocationSums.Add(FVector::ZeroVector);
+			}
+
+			FGroundItemPile& Pile = Piles[PileIndex];
+			Pile.Count++;
+			Pile.HighestRarity = FMath::Max(Pile.HighestRarity, Storage.Rarities[DenseIndex]);
+			LocationSums[PileIndex] += Location;
+		}
+	}
+
+	TArray<FTransform> PileTransforms;
+	PileTransforms.Reserve(Piles.Num());
+
+	for (int32 i = 0; i < Piles.Num(); ++i)
+	{
+		FGroundItemPile& Pile = Piles[i];
+		Pile.Location = LocationSums[i] / Pile.Count;
+
+		// Bigger piles read bigger, but growth flattens out
+		const float Scale = 1.0f + 0.25f * FMath::Log2(static_cast<float>(Pile.Count));
+		PileTransforms.Emplace(FRotator::ZeroRotator, Pile.Location, FVector(Scale));
+	}
+
+	if (!PileISM || !IsValid(PileISM) || PileISM->GetStaticMesh() != PileMesh)
+	{
+		EnsureISMContainerExists();
+		if (!ISMContainerActor)
+		{
+			return;
+		}
+
+		if (PileISM && IsValid(PileISM))
+		{
+			PileISM->DestroyComponent();
+		}
+
+		PileISM = NewObject<UInstancedStaticMeshComponent>(ISMContainerActor, MakeUniqueObjectName(ISMContainerActor,
+			UInstancedStaticMeshComponent::StaticClass(), TEXT("ISM_GroundItemPiles")));
+		PileISM->SetStaticMesh(PileMesh);
+		PileISM->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		PileISM->RegisterComponent();
+		PileISM->AttachToComponent(ISMContainerActor->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+	}
+
+	// Piles only change when the collapsed set does - a full rebuild is cheap enough
+	PileISM->ClearInstances();
+	if (PileTransforms.Num() > 0)
+	{
+		PileISM->AddInstances(PileTransforms, false, true, false);
+	}
+
+	UE_LOG(LogGroundItemSubsystem, Verbose, TEXT("RebuildPiles: %d collapsed partitions -> %d piles"), CollapsedCells.Num(), Piles.Num());
+}
+
+void UGroundItemSubsystem::ResetPileLOD()
+{
+	for (const TPair<FGroundItemISMKey, UInstancedStaticMeshComponent*>& Pair : CellISMs)
+	{
+		SetPartitionCollapsed(Pair.Value, false);
+	}
+
+	CollapsedCells.Empty();
+	Piles.Reset();
+
+	if (PileISM && IsValid(PileISM))
+	{
+		PileISM->ClearInstances();
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// REPLICATION (CLIENT)
+// ═══════════════════════════════════════════════════════════════════════
+
+void UGroundItemSubsystem::ApplyReplicatedItem(AGroundItemNetCell* Cell, const FGroundItemNetEntry& Entry, UStaticMesh* Mesh)
+{
+	const int32 ItemID = Entry.ItemID;
+
+	// Picked up locally, server hasn't answered - keep it hidden but track where it now lives
+	if (FPredictedRemoval* Predicted = PredictedRemovals.Find(ItemID))
+	{
+		Predicted->Source.Cell = Cell;
+		Predicted->Source.Entry = Entry;
+		Predicted->Mesh = Mesh;
+		return;
+	}
+
+	const FVector Location = Entry.GetLocation(Cell->GetCell());
+
+	if (Storage.Contains(ItemID))
+	{
+		ReplicatedItems.Add(ItemID, { Cell, Entry });
+
+		if (!GetItemLocation(ItemID)->Equals(Location, 1.0f))
+		{
+			UpdateItemLocation(ItemID, Location);
+		}
+		return;
+	}
+
+	EnsureISMContainerExists();
+
+	UInstancedStaticMeshComponent* ISM = GetOrCreateISMComponent(Mesh, Location);
+	if (!ISM)
+	{
+		return;
+	}
+
+	// No UItemInstance on clients and no lifetime / caps - the server owns those
+	const int32 DenseIndex = Storage.Add(ItemID, nullptr, Location, Entry.GetRotation(), FGroundItemISMData(ISM, INDEX_NONE, Mesh), GetWorld()->GetTimeSeconds());
+	Storage.Rarities[DenseIndex] = Entry.Rarity;
+
+	SpatialGrid.Add(ItemID, Location);
+	ReplicatedItems.Add(ItemID, { Cell, Entry });
+
+	PendingInstances.Add(ItemID);
+
+	OnGroundItemAdded.Broadcast(ItemID, Location);
+}
+
+void UGroundItemSubsystem::RemoveReplicatedItems(AGroundItemNetCell* Cell, const TArray<int32>& ItemIDs)
+{
+	TArray<int32> OwnedIDs;
+	OwnedIDs.Reserve(ItemIDs.Num());
+
+	for (int32 ItemID : ItemIDs)
+	{
+		const FReplicatedItem* Owner = ReplicatedItems.Find(ItemID);
+		if (Owner && Owner->Cell.Get() == Cell)
+		{
+			OwnedIDs.Add(ItemID);
+		}
+
+		// Already hidden by prediction - the server removed it, so a rollback must not bring it back
+		const FPredictedRemoval* Predicted = PredictedRemovals.Find(ItemID);
+		if (Predicted && Predicted->Source.Cell.Get() == Cell)
+		{
+			PredictedRemovals.Remove(ItemID);
+		}
+	}
+
+	if (OwnedIDs.Num() > 0)
+	{
+		RemoveMultipleItemsFromGround(OwnedIDs);
+	}
+}
+
+TArray<int32> UGroundItemSubsystem::HidePredictedItems(const TArray<int32>& ItemIDs)
+{
+	TArray<int32> HiddenIDs;
+	HiddenIDs.Reserve(ItemIDs.Num());
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	for (int32 ItemID : ItemIDs)
+	{
+		const int32 DenseIndex = Storage.FindIndex(ItemID);
+		if (DenseIndex == INDEX_NONE || PredictedRemovals.Contains(ItemID))
+		{
+			continue;
+		}
+
+		FPredictedRemoval& Predicted = PredictedRemovals.Add(ItemID);
+		if (const FReplicatedItem* Replicated = ReplicatedItems.Find(ItemID))
+		{
+			Predicted.Source = *Replicated;
+		}
+		Predicted.Mesh = Storage.ISMSlots[DenseIndex].Mesh;
+		Predicted.HiddenTime = Now;
+
+		HiddenIDs.Add(ItemID);
+	}
+
+	// One batch removal - instances, grid and focus all forget the items this frame
+	RemoveMultipleItemsFromGround(HiddenIDs);
+
+	return HiddenIDs;
+}
+
+void UGroundItemSubsystem::ConfirmPredictedItems(const TArray<int32>& ItemIDs)
+{
+	for (int32 ItemID : ItemIDs)
+	{
+		PredictedRemovals.Remove(ItemID);
+	}
+}
+
+void UGroundItemSubsystem::RestorePredictedItems(const TArray<int32>& ItemIDs)
+{
+	for (int32 ItemID : ItemIDs)
+	{
+		FPredictedRemoval Predicted;
+		if (!PredictedRemovals.RemoveAndCopyValue(ItemID, Predicted))
+		{
+			continue;
+		}
+
+		// Cell gone means the server dropped the item too
+		AGroundItemNetCell* Cell = Predicted.Source.Cell.Get();
+		UStaticMesh* Mesh = Predicted.Mesh.Get();
+		if (Cell && Mesh)
+		{
+			ApplyReplicatedItem(Cell, Predicted.Source.Entry, Mesh);
+		}
+	}
+
+	UE_LOG(LogGroundItemSubsystem, Verbose, TEXT("RestorePredictedItems: Rolled back %d items"), ItemIDs.Num());
+}
+
+void UGroundItemSubsystem::ExpirePredictedRemovals()
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const double Now = World->GetTimeSeconds();
+
+	TArray<int32> ExpiredIDs;
+	for (const TPair<int32, FPredictedRemoval>& Pair : PredictedRemovals)
+	{
+		if (Now - Pair.Value.HiddenTime > PredictedRemovalTimeout)
+		{
+			ExpiredIDs.Add(Pair.Key);
+		}
+	}
+
+	if (ExpiredIDs.Num() > 0)
+	{
+		UE_LOG(LogGroundItemSubsystem, Log, TEXT("ExpirePredictedRemovals: No answer for %d items after %.1fs, restoring"),
+			ExpiredIDs.Num(), PredictedRemovalTimeout);
+		RestorePredictedItems(ExpiredIDs);
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// LIFETIME & CAPS
+// ═══════════════════════════════════════════════════════════════════════
+
+void UGroundItemSubsystem::ProcessLifetimes()
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	ExpiredScratch.Reset();
+	LifetimeWheel.Advance(World->GetTimeSeconds(), ExpiredScratch);
+
+	// Drop entries for items picked up before they expired, or whose ID now belongs to a newer item
+	TArray<int32> ExpiredIDs;
+	ExpiredIDs.Reserve(ExpiredScratch.Num());
+	for (const FGroundItemTimingWheel::FExpired& Expired : ExpiredScratch)
+	{
+		const int32 DenseIndex = Storage.FindIndex(Expired.ItemID);
+		if (DenseIndex != INDEX_NONE && Storage.Generations[DenseIndex] == Expired.Generation)
+		{
+			ExpiredIDs.Add(Expired.ItemID);
+		}
+	}
+
+	if (ExpiredIDs.Num() > 0)
+	{
+		DespawnItems(ExpiredIDs, EGroundItemDespawnReason::GIDR_Expired);
+	}
+}
+
+void UGroundItemSubsystem::EnforceCaps()
+{
+	bCapCheckPending = false;
+
+	const int32 CountCap = LifetimeSettings.MaxGroundItems;
+	const int64 MemoryCap = static_cast<int64>(LifetimeSettings.MaxGroundItemMemoryMB * 1024.0f * 1024.0f);
+
+	const bool bOverCount = CountCap > 0 && Storage.Num() > CountCap;
+	const bool bOverMemory = MemoryCap > 0 && TotalMemoryEstimate > MemoryCap;
+
+	if (!bOverCount && !bOverMemory)
+	{
+		return;
+	}
+
+	// Evict below the cap (not just to it) so the next drop doesn't trigger another sort
+	const float Fraction = FMath::Clamp(LifetimeSettings.EvictionTargetFraction, 0.5f, 1.0f);
+	const int32 TargetCount = CountCap > 0 ? FMath::FloorToInt(CountCap * Fraction) : MAX_int32;
+	const int64 TargetMemory = MemoryCap > 0 ? static_cast<int64>(MemoryCap * Fraction) : MAX_int64;
+
+	// Lowest rarity tier first, then lowest value, oldest first on ties (streams the packed arrays)
+	TArray<int32> Order;
+	Order.Reserve(Storage.Num());
+	for (int32 i = 0; i < Storage.Num(); ++i)
+	{
+		Order.Add(i);
+	}
+
+	Order.Sort([this](int32 A, int32 B)
+	{
+		const int32 RankA = FGroundItemLifetimeSettings::GetEvictionRank(Storage.Rarities[A]);
+		const int32 RankB = FGroundItemLifetimeSettings::GetEvictionRank(Storage.Rarities[B]);
+		if (RankA != RankB)
+		{
+			return RankA < RankB;
+		}
+		if (Storage.EvictionValues[A] != Storage.EvictionValues[B])
+		{
+			return Storage.EvictionValues[A] < Storage.EvictionValues[B];
+		}
+		return Storage.SpawnTimes[A] < Storage.SpawnTimes[B];
+	});
+
+	int32 RemainingCount = Storage.Num();
+	int64 RemainingMemory = TotalMemoryEstimate;
+
+	TArray<int32> ToEvict;
+	for (int32 DenseIndex : Order)
+	{
+		if (RemainingCount <= TargetCount && RemainingMemory <= TargetMemory)
+		{
+			break;
+		}
+
+		ToEvict.Add(Storage.IDs[DenseIndex]);
+		RemainingCount--;
+		RemainingMemory -= Storage.MemoryEstimates[DenseIndex];
+	}
+
+	UE_LOG(LogGroundItemSubsystem, Log, TEXT("EnforceCaps: Evicting %d items (%d items, %.1f MB on ground)"),
+		ToEvict.Num(), Storage.Num(), TotalMemoryEstimate / (1024.0 * 1024.0));
+
+	DespawnItems(ToEvict, EGroundItemDespawnReason::GIDR_Evicted);
+}
+
+TArray<UItemInstance*> UGroundItemSubsystem::DespawnItems(const TArray<int32>& ItemIDs, EGroundItemDespawnReason Reason)
+{
+	TArray<UItemInstance*> Removed = RemoveMultipleItemsFromGround(ItemIDs);
+
+	if (Removed.Num() > 0)
+	{
+		OnGroundItemsDespawned.Broadcast(Removed, Reason);
+	}
+
+	return Removed;
+}
+
+int32 UGroundItemSubsystem::EstimateItemMemory(const UItemInstance* Item)
+{
+	// Per-item subsystem bookkeeping: storage row, grid entry, reverse maps, ISM instance
+	constexpr int32 BookkeepingBytes = 160;
+
+	return Item->GetClass()->GetStructureSize()
+		+ static_cast<int32>(Item->Stats.Prefixes.GetAllocatedSize())
+		+ static_cast<int32>(Item->Stats.Suffixes.GetAllocatedSize())
+		+ static_cast<int32>(Item->Stats.Implicits.GetAllocatedSize())
+		+ static_cast<int32>(Item->Stats.Crafted.GetAllocatedSize())
+		+ BookkeepingBytes;
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// BATCHED PROXIMITY QUERIES
+// ═══════════════════════════════════════════════════════════════════════
+
+int32 UGroundItemSubsystem::RegisterProximityQuery()
+{
+	return ProximityQueries.Add(FProximityQuerySlot());
+}
+
+void UGroundItemSubsystem::UnregisterProximityQuery(int32 QueryHandle)
+{
+	if (ProximityQueries.IsValidIndex(QueryHandle))
+	{
+		ProximityQueries.RemoveAt(QueryHandle);
+	}
+}
+
+void UGroundItemSubsystem::UpdateProximityQuery(int32 QueryHandle, const FVector& Location, float MaxDistance)
+{
+	if (ProximityQueries.IsValidIndex(QueryHandle))
+	{
+		FProximityQuerySlot& Slot = ProximityQueries[QueryHandle];
+		Slot.Location = Location;
+		Slot.MaxDistance = MaxDistance;
+		Slot.bHasLocation = true;
+	}
+}
+
+int32 UGroundItemSubsystem::GetProximityResult(int32 QueryHandle) const
+{
+	if (!ProximityQueries.IsValidIndex(QueryHandle))
+	{
+		return INDEX_NONE;
+	}
+
+	// Result may be up to one batch old - drop it if the item was picked up since
+	const int32 ResultID = ProximityQueries[QueryHandle].ResultID;
+	return Storage.Contains(ResultID) ? ResultID : INDEX_NONE;
+}
+
+void UGroundItemSubsystem::ProcessProximityQueries()
+{
+	ProximityScratch.Reset();
+	ProximityScratchHandles.Reset();
+
+	for (auto It = ProximityQueries.CreateConstIterator(); It; ++It)
+	{
+		if (!It->bHasLocation)
+		{
+			continue;
+		}
+
+		FGroundItemSpatialGrid::FNearestQuery& Query = ProximityScratch.AddDefaulted_GetRef();
+		Query.Location = It->Location;
+		Query.MaxDistance = It->MaxDistance;
+		ProximityScratchHandles.Add(It.GetIndex());
+	}
+
+	if (ProximityScratch.Num() == 0)
+	{
+		return;
+	}
+
+	SpatialGrid.FindNearestBatch(ProximityScratch);
+
+	for (int32 i = 0; i < ProximityScratch.Num(); ++i)
+	{
+		ProximityQueries[ProximityScratchHandles[i]].ResultID = ProximityScratch[i].ResultID;
+	}
+}
+
 // ═══════════════════════════════════════════════════════════════════════
 // DEBUG
 // ═══════════════════════════════════════════════════════════════════════
@@ -466,17 +1712,18 @@ void UGroundItemSubsystem::DebugDrawAllItems(float Duration)
 		return;
 	}
 
-	for (const TPair<int32, FVector>& Pair : InstanceLocations)
+	for (int32 i = 0; i < Storage.Num(); ++i)
 	{
-		DrawDebugSphere(World, Pair.Value, 25.0f, 8, FColor::Yellow, false, Duration);
+		const FVector& Location = Storage.Locations[i];
+		DrawDebugSphere(World, Location, 25.0f, 8, FColor::Yellow, false, Duration);
 		
-		if (UItemInstance* const* Found = GroundItems.Find(Pair.Key))
+		if (UItemInstance* Item = Storage.Items[i])
 		{
-			FString DebugText = FString::Printf(TEXT("[%d] %s"), Pair.Key, *(*Found)->GetDisplayName().ToString());
-			DrawDebugString(World, Pair.Value + FVector(0, 0, 50), DebugText, nullptr, FColor::White, Duration);
+			FString DebugText = FString::Printf(TEXT("[%d] %s"), Storage.IDs[i], *Item->GetDisplayName().ToString());
+			DrawDebugString(World, Location + FVector(0, 0, 50), DebugText, nullptr, FColor::White, Duration);
 		}
 	}
 	
-	UE_LOG(LogGroundItemSubsystem, Log, TEXT("DebugDrawAllItems: Drew %d items for %.1fs"), InstanceLocations.Num(), Duration);
+	UE_LOG(LogGroundItemSubsystem, Log, TEXT("DebugDrawAllItems: Drew %d items for %.1fs"), Storage.Num(), Duration);
 }
 #endif
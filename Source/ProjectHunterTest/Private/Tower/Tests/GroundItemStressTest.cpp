@@ -0,0 +1,401 @@
+// Tower/Tests/GroundItemStressTest.cpp
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Tower/Subsystem/GroundItemSubsystem.h"
+#include "Character/Component/Interaction/GroundItemPickupManager.h"
+#include "Character/Component/Interaction/InteractionValidatorManager.h"
+#include "Character/Component/InventoryManager.h"
+#include "Item/ItemInstance.h"
+#include "Item/Library/ItemStructs.h"
+#include "Engine/DataTable.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+#include "HAL/FileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGroundItemStress, Log, All);
+
+/**
+ * Ground item subsystem stress benchmark.
+ * Fills the floor of a throwaway world at a fixed density (so only the item count changes between
+ * tiers) and times add, nearest, radius, single removal, batch removal, pickup-all and clear, plus
+ * container memory. Pickup-all goes through FGroundItemPickupManager, the validator and a real
+ * inventory, the same path a player's Pickup All request takes on the server.
+ *
+ * Headless:
+ *   UnrealEditor-Cmd <Project> -nullrhi -unattended -ExecCmds="Automation RunTests ProjectHunter.GroundItems.Stress;Quit"
+ * Optional: -GroundItemStressTable=<BaseItemTablePath> (default: engine basic shapes)
+ *           -GroundItemStressCounts=1000,10000,100000 -GroundItemStressMeshes=8
+ *           -GroundItemStressQueries=1000 -GroundItemStressLabel=<commit>
+ * Rows are appended to Saved/Profiling/GroundItemStress.csv; pass a Label to compare runs.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGroundItemStressTest, "ProjectHunter.GroundItems.Stress",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+namespace GroundItemStress
+{
+	/** Transient base table with one row per engine basic shape */
+	static UDataTable* CreateBasicShapeTable()
+	{
+		UDataTable* Table = NewObject<UDataTable>(GetTransientPackage(), TEXT("GroundItemStressTable"));
+		Table->RowStruct = FItemBase::StaticStruct();
+
+		static const TCHAR* ShapePaths[] =
+		{
+			TEXT("/Engine/BasicShapes/Cube.Cube"),
+			TEXT("/Engine/BasicShapes/Sphere.Sphere"),
+			TEXT("/Engine/BasicShapes/Cylinder.Cylinder"),
+			TEXT("/Engine/BasicShapes/Cone.Cone"),
+			TEXT("/Engine/BasicShapes/Plane.Plane"),
+		};
+
+		for (const TCHAR* ShapePath : ShapePaths)
+		{
+			UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, ShapePath);
+			if (!Mesh)
+			{
+				continue;
+			}
+
+			FItemBase Row;
+			Row.ItemID = FName(*FString::Printf(TEXT("Stress_%s"), *Mesh->GetName()));
+			Row.ItemName = FText::FromString(Mesh->GetName());
+			Row.ItemType = EItemType::IT_Material;
+			Row.StaticMesh = Mesh;
+			Table->AddRow(Row.ItemID, Row);
+		}
+
+		return Table;
+	}
+
+	/** Game world that exists only for the duration of the test */
+	static UWorld* CreateTestWorld()
+	{
+		UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("GroundItemStressWorld"));
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+		return World;
+	}
+
+	static void DestroyTestWorld(UWorld* World)
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+}
+
+bool FGroundItemStressTest::RunTest(const FString& Parameters)
+{
+	// ═══════════════════════════════════════════════
+	// OPTIONS
+	// ═══════════════════════════════════════════════
+
+	FString TablePath;
+	FString CountsString = TEXT("1000,10000,100000");
+	FString Label = TEXT("local");
+	int32 MaxMeshes = 8;
+	int32 NumQueries = 1000;
+	FParse::Value(FCommandLine::Get(), TEXT("GroundItemStressTable="), TablePath);
+	FParse::Value(FCommandLine::Get(), TEXT("GroundItemStressCounts="), CountsString);
+	FParse::Value(FCommandLine::Get(), TEXT("GroundItemStressLabel="), Label);
+	FParse::Value(FCommandLine::Get(), TEXT("GroundItemStressMeshes="), MaxMeshes);
+	FParse::Value(FCommandLine::Get(), TEXT("GroundItemStressQueries="), NumQueries);
+	MaxMeshes = FMath::Max(1, MaxMeshes);
+	NumQueries = FMath::Max(1, NumQueries);
+
+	TArray<int32> Counts;
+	{
+		TArray<FString> CountStrings;
+		CountsString.ParseIntoArray(CountStrings, TEXT(","));
+		for (const FString& CountString : CountStrings)
+		{
+			Counts.Add(FMath::Max(1, FCString::Atoi(*CountString)));
+		}
+	}
+
+	if (!TestTrue(TEXT("At least one item count"), Counts.Num() > 0))
+	{
+		return false;
+	}
+
+	UDataTable* BaseTable = TablePath.IsEmpty()
+		? GroundItemStress::CreateBasicShapeTable()
+		: Cast<UDataTable>(FSoftObjectPath(TablePath).TryLoad());
+	if (!TestNotNull(TEXT("Base item table"), BaseTable))
+	{
+		return false;
+	}
+
+	constexpr float Spacing = 150.0f;
+	constexpr float QueryRadius = 1000.0f;
+	constexpr float PickupRadius = 400.0f;
+	constexpr int32 BatchSize = 100;
+
+	// ═══════════════════════════════════════════════
+	// ONE BASE ROW PER DISTINCT MESH
+	// ═══════════════════════════════════════════════
+
+	TArray<FName> MeshRows;
+	{
+		TSet<UStaticMesh*> SeenMeshes;
+		for (const FName& RowName : BaseTable->GetRowNames())
+		{
+			const FItemBase* Row = BaseTable->FindRow<FItemBase>(RowName, TEXT("GroundItemStress"), false);
+			if (Row && Row->StaticMesh && !SeenMeshes.Contains(Row->StaticMesh))
+			{
+				SeenMeshes.Add(Row->StaticMesh);
+				MeshRows.Add(RowName);
+				if (MeshRows.Num() >= MaxMeshes)
+				{
+					break;
+				}
+			}
+		}
+	}
+
+	if (!TestTrue(TEXT("Base table has rows with a ground mesh"), MeshRows.Num() > 0))
+	{
+		return false;
+	}
+
+	// ═══════════════════════════════════════════════
+	// TEMPORARY WORLD + PICKER
+	// ═══════════════════════════════════════════════
+
+	UWorld* World = GroundItemStress::CreateTestWorld();
+	ON_SCOPE_EXIT
+	{
+		GroundItemStress::DestroyTestWorld(World);
+	};
+
+	UGroundItemSubsystem* Subsystem = World->GetSubsystem<UGroundItemSubsystem>();
+	if (!TestNotNull(TEXT("Ground item subsystem"), Subsystem))
+	{
+		return false;
+	}
+
+	// No lifetimes or caps during the run - every tier keeps all its items
+	Subsystem->LifetimeSettings.LifetimeByRarity.Empty();
+	Subsystem->LifetimeSettings.MaxGroundItems = 0;
+	Subsystem->LifetimeSettings.MaxGroundItemMemoryMB = 0.0f;
+
+	const int32 MaxCount = FMath::Max(Counts);
+
+	// Stand-in for the player: an inventory big enough to take everything it walks over
+	AActor* Picker = World->SpawnActor<AActor>();
+	USceneComponent* PickerRoot = NewObject<USceneComponent>(Picker, TEXT("Root"));
+	Picker->SetRootComponent(PickerRoot);
+	PickerRoot->RegisterComponent();
+
+	UInventoryManager* Inventory = NewObject<UInventoryManager>(Picker, TEXT("Inventory"));
+	Inventory->MaxSlots = MaxCount;
+	Inventory->SetMaxWeight(TNumericLimits<float>::Max());
+	Inventory->RegisterComponent();
+
+	FGroundItemPickupManager PickupManager;
+	PickupManager.PickupRadius = PickupRadius;
+	PickupManager.Initialize(Picker, World);
+
+	FInteractionValidatorManager Validator;
+	Validator.bLogValidationFailures = false;
+	Validator.Initialize(Picker, World);
+
+	// Per-item inventory logging would dominate the pickup timing
+	const ELogVerbosity::Type SavedTempVerbosity = LogTemp.GetVerbosity();
+	const ELogVerbosity::Type SavedPickupVerbosity = LogGroundItemPickupManager.GetVerbosity();
+
+	FString Csv;
+	auto Report = [&](int32 Count, const TCHAR* Operation, int32 NumOps, double Ms)
+	{
+		const double UsPerOp = NumOps > 0 ? Ms * 1000.0 / NumOps : 0.0;
+		UE_LOG(LogGroundItemStress, Display, TEXT("  %-14s %8d ops | %9.2f ms | %8.3f us/op"), Operation, NumOps, Ms, UsPerOp);
+		Csv += FString::Printf(TEXT("%s,%d,%d,%s,%d,%.3f,%.4f\n"), *Label, Count, MeshRows.Num(), Operation, NumOps, Ms, UsPerOp);
+	};
+
+	UE_LOG(LogGroundItemStress, Display, TEXT("═══════════════════════════════════════════"));
+	UE_LOG(LogGroundItemStress, Display, TEXT("GROUND ITEM STRESS (%s, %d meshes, %d queries, %.0f cm spacing)"),
+		*Label, MeshRows.Num(), NumQueries, Spacing);
+
+	FRandomStream Rand(12345);
+	for (const int32 Count : Counts)
+	{
+		// Fresh items per tier: pickup stacks into the inventory and mutates what it takes
+		TArray<UItemInstance*> Items;
+		Items.Reserve(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			FDataTableRowHandle Handle;
+			Handle.DataTable = BaseTable;
+			Handle.RowName = MeshRows[i % MeshRows.Num()];
+
+			UItemInstance* Item = NewObject<UItemInstance>(GetTransientPackage());
+			Item->SetSeed(Rand.RandHelper(MAX_int32));
+			Item->Initialize(Handle, Rand.RandRange(1, 100),
+				static_cast<EItemRarity>(Rand.RandRange(
+					static_cast<int32>(EItemRarity::IR_GradeF),
+					static_cast<int32>(EItemRarity::IR_GradeSS))));
+			Item->AddToRoot();
+			Items.Add(Item);
+		}
+
+		// Fixed density: area grows with the count
+		const float AreaSize = FMath::Sqrt(static_cast<float>(Count)) * Spacing;
+		FRandomStream TierRand(Count);
+
+		TArray<FVector> Locations;
+		Locations.Reserve(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Locations.Emplace(TierRand.FRandRange(0.0f, AreaSize), TierRand.FRandRange(0.0f, AreaSize), 0.0f);
+		}
+
+		TArray<FVector> QueryPoints;
+		QueryPoints.Reserve(NumQueries);
+		for (int32 i = 0; i < NumQueries; ++i)
+		{
+			QueryPoints.Emplace(TierRand.FRandRange(0.0f, AreaSize), TierRand.FRandRange(0.0f, AreaSize), 0.0f);
+		}
+
+		UE_LOG(LogGroundItemStress, Display, TEXT("── %d items (%.0f m square) ──"), Count, AreaSize / 100.0f);
+
+		// ADD (+ the deferred ISM flush it implies)
+		const uint64 UsedBefore = FPlatformMemory::GetStats().UsedPhysical;
+		double StartTime = FPlatformTime::Seconds();
+		TArray<int32> ItemIDs = Subsystem->AddItemsToGround(Items, Locations);
+		Subsystem->FlushPendingInstances();
+		Report(Count, TEXT("Add"), Count, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+		TestEqual(TEXT("All items reached the ground"), ItemIDs.Num(), Count);
+
+		const int64 UsedDelta = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<int64>(UsedBefore);
+		const SIZE_T StorageBytes = Subsystem->GetStorage().GetAllocatedSize();
+		const SIZE_T GridBytes = Subsystem->GetSpatialGrid().GetAllocatedSize();
+		UE_LOG(LogGroundItemStress, Display, TEXT("  Memory: storage %.1f KB | grid %.1f KB | %d ISMs | items est. %.1f MB | process +%.1f MB"),
+			StorageBytes / 1024.0, GridBytes / 1024.0, Subsystem->GetNumISMComponents(),
+			Subsystem->GetEstimatedMemoryBytes() / (1024.0 * 1024.0), UsedDelta / (1024.0 * 1024.0));
+		Csv += FString::Printf(TEXT("%s,%d,%d,MemStorageBytes,1,%llu,0\n"), *Label, Count, MeshRows.Num(), static_cast<uint64>(StorageBytes));
+		Csv += FString::Printf(TEXT("%s,%d,%d,MemGridBytes,1,%llu,0\n"), *Label, Count, MeshRows.Num(), static_cast<uint64>(GridBytes));
+
+		// NEAREST
+		int32 Found = 0;
+		StartTime = FPlatformTime::Seconds();
+		for (const FVector& Point : QueryPoints)
+		{
+			int32 NearestID = INDEX_NONE;
+			Found += Subsystem->GetNearestItem(Point, QueryRadius, NearestID) ? 1 : 0;
+		}
+		Report(Count, TEXT("Nearest"), NumQueries, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+		// RADIUS
+		TArray<int32> RadiusIDs;
+		int64 RadiusHits = 0;
+		StartTime = FPlatformTime::Seconds();
+		for (const FVector& Point : QueryPoints)
+		{
+			RadiusIDs.Reset();
+			RadiusHits += Subsystem->GetItemsInRadius(Point, QueryRadius, RadiusIDs);
+		}
+		Report(Count, TEXT("Radius"), NumQueries, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+		// SINGLE + BATCH REMOVAL (disjoint random tenths)
+		const int32 NumRemove = FMath::Max(1, Count / 10);
+		for (int32 i = ItemIDs.Num() - 1; i > 0; --i)
+		{
+			ItemIDs.Swap(i, TierRand.RandRange(0, i));
+		}
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumRemove && i < ItemIDs.Num(); ++i)
+		{
+			Subsystem->RemoveItemFromGround(ItemIDs[i]);
+		}
+		Report(Count, TEXT("Remove"), NumRemove, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+		const int32 BatchEnd = FMath::Min(NumRemove * 2, ItemIDs.Num());
+		StartTime = FPlatformTime::Seconds();
+		for (int32 i = NumRemove; i < BatchEnd; i += BatchSize)
+		{
+			const int32 Num = FMath::Min(BatchSize, BatchEnd - i);
+			Subsystem->RemoveMultipleItemsFromGround(TArray<int32>(ItemIDs.GetData() + i, Num));
+		}
+		Report(Count, TEXT("BatchRemove"), FMath::Max(0, BatchEnd - NumRemove), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+		// PICKUP-ALL (gather, validate and move into the inventory, as the server RPC does)
+		LogTemp.SetVerbosity(ELogVerbosity::Warning);
+		LogGroundItemPickupManager.SetVerbosity(ELogVerbosity::Warning);
+
+		TArray<int32> GatheredIDs;
+		TArray<int32> ValidIDs;
+		int64 PickedUp = 0;
+		int64 Returned = 0;
+		StartTime = FPlatformTime::Seconds();
+		for (const FVector& Point : QueryPoints)
+		{
+			Picker->SetActorLocation(Point);
+			GatheredIDs.Reset();
+			ValidIDs.Reset();
+			PickupManager.GatherNearbyItemIDs(Point, GatheredIDs);
+			Validator.ValidateGroundItemBatch(GatheredIDs, Point, PickupRadius, ValidIDs);
+
+			FGroundItemPickupResult Result;
+			Result.NumRequested = GatheredIDs.Num();
+			Result.NumRejected = GatheredIDs.Num() - ValidIDs.Num();
+			PickupManager.PickupItemsToInventory(ValidIDs, Result);
+			PickedUp += Result.PickedUpItemIDs.Num();
+			Returned += Result.NumReturned;
+		}
+		Report(Count, TEXT("PickupAll"), NumQueries, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+		LogTemp.SetVerbosity(SavedTempVerbosity);
+		LogGroundItemPickupManager.SetVerbosity(SavedPickupVerbosity);
+		TestEqual(TEXT("Pickup-all never ran out of inventory room"), Returned, static_cast<int64>(0));
+
+		// CLEAR
+		const int32 Remaining = Subsystem->GetTotalItemCount();
+		StartTime = FPlatformTime::Seconds();
+		Subsystem->ClearAllItems();
+		Report(Count, TEXT("Clear"), Remaining, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+		UE_LOG(LogGroundItemStress, Display, TEXT("  Hits: nearest %d/%d | radius %.1f avg | pickup-all %.1f avg"),
+			Found, NumQueries, RadiusHits / static_cast<double>(NumQueries), PickedUp / static_cast<double>(NumQueries));
+
+		Inventory->ClearAll();
+		for (UItemInstance* Item : Items)
+		{
+			Item->RemoveFromRoot();
+		}
+	}
+
+	UE_LOG(LogGroundItemStress, Display, TEXT("═══════════════════════════════════════════"));
+
+	// ═══════════════════════════════════════════════
+	// CSV (append, header once)
+	// ═══════════════════════════════════════════════
+
+	const FString CsvPath = FPaths::ProfilingDir() / TEXT("GroundItemStress.csv");
+	if (!IFileManager::Get().FileExists(*CsvPath))
+	{
+		Csv = TEXT("Label,Items,Meshes,Operation,Ops,TotalMs,UsPerOp\n") + Csv;
+	}
+
+	if (FFileHelper::SaveStringToFile(Csv, *CsvPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append))
+	{
+		UE_LOG(LogGroundItemStress, Display, TEXT("Results appended to %s"), *CsvPath);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,143 @@
+// Character/Component/ConsumableCooldownManager.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "ConsumableCooldownManager.generated.h"
+
+class UItemInstance;
+
+/**
+ * Single active cooldown (for replication)
+ * Stored as absolute server timestamps - nothing ticks
+ * Doubles: float world time loses sub-frame precision after a few hours of play
+ */
+USTRUCT(BlueprintType)
+struct FConsumableCooldownEntry
+{
+	GENERATED_BODY()
+
+	/** Cooldown group, or base item row name if the item has no group */
+	UPROPERTY(BlueprintReadOnly)
+	FName CooldownKey = NAME_None;
+
+	/** Server world time the cooldown started */
+	UPROPERTY(BlueprintReadOnly)
+	double StartTime = 0.0;
+
+	/** Server world time the cooldown ends */
+	UPROPERTY(BlueprintReadOnly)
+	double EndTime = 0.0;
+
+	FConsumableCooldownEntry() = default;
+
+	FConsumableCooldownEntry(FName InKey, double InStart, double InEnd)
+		: CooldownKey(InKey), StartTime(InStart), EndTime(InEnd)
+	{}
+
+	double GetDuration() const { return EndTime - StartTime; }
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnConsumableCooldownStarted, FName, CooldownKey, float, Duration);
+
+/**
+ * Consumable Cooldown Manager
+ *
+ * SINGLE RESPONSIBILITY: Per-character consumable cooldowns
+ * - Cooldowns keyed by cooldown group (or base item) - one entry per group
+ * - Stored as absolute server timestamps, progress computed on read
+ * - Expired entries pruned lazily when a new cooldown starts
+ *
+ * DOES NOT:
+ * - Tick (zero cost for potions sitting in bags)
+ * - Store cooldown state on UItemInstance
+ *
+ * MULTIPLAYER READY:
+ * - Server authoritative, replicated to owner only
+ * - Shared-group cooldowns replicate once, not per item
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class PROJECTHUNTERTEST_API UConsumableCooldownManager : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UConsumableCooldownManager();
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	// ═══════════════════════════════════════════════
+	// ITEM API
+	// ═══════════════════════════════════════════════
+
+	/**
+	 * Get cooldown key for an item
+	 * @return Item's cooldown group if set, otherwise its base row qualified by table ("Table.Row")
+	 */
+	static FName GetCooldownKey(const UItemInstance* Item);
+
+	/** Start cooldown for item (uses FConsumableData::Cooldown) */
+	UFUNCTION(BlueprintCallable, Category = "Cooldown")
+	void StartItemCooldown(const UItemInstance* Item);
+
+	/** Is item's cooldown group currently on cooldown? */
+	UFUNCTION(BlueprintPure, Category = "Cooldown")
+	bool IsItemOnCooldown(const UItemInstance* Item) const;
+
+	/** Get item cooldown progress (0.0 = just used, 1.0 = ready) */
+	UFUNCTION(BlueprintPure, Category = "Cooldown")
+	float GetItemCooldownProgress(const UItemInstance* Item) const;
+
+	// ═══════════════════════════════════════════════
+	// KEY API
+	// ═══════════════════════════════════════════════
+
+	UFUNCTION(BlueprintCallable, Category = "Cooldown")
+	void StartCooldown(FName CooldownKey, float Duration);
+
+	UFUNCTION(BlueprintPure, Category = "Cooldown")
+	bool IsOnCooldown(FName CooldownKey) const;
+
+	/** Seconds remaining (0 if ready) */
+	UFUNCTION(BlueprintPure, Category = "Cooldown")
+	float GetRemainingTime(FName CooldownKey) const;
+
+	/** Progress (0.0 = just used, 1.0 = ready) */
+	UFUNCTION(BlueprintPure, Category = "Cooldown")
+	float GetCooldownProgress(FName CooldownKey) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Cooldown")
+	void ClearAllCooldowns();
+
+	// ═══════════════════════════════════════════════
+	// EVENTS
+	// ═══════════════════════════════════════════════
+
+	/** Called when a cooldown starts (UI can animate from this, no polling needed) */
+	UPROPERTY(BlueprintAssignable, Category = "Cooldown|Events")
+	FOnConsumableCooldownStarted OnCooldownStarted;
+
+protected:
+	// ═══════════════════════════════════════════════
+	// REPLICATION
+	// ═══════════════════════════════════════════════
+
+	/** Active cooldowns (small - one entry per group in use) */
+	UPROPERTY(ReplicatedUsing = OnRep_ActiveCooldowns)
+	TArray<FConsumableCooldownEntry> ActiveCooldowns;
+
+	UFUNCTION()
+	void OnRep_ActiveCooldowns();
+
+	// ═══════════════════════════════════════════════
+	// INTERNAL
+	// ═══════════════════════════════════════════════
+
+	/** Server world time (synced on clients via GameState) */
+	double GetServerTime() const;
+
+	const FConsumableCooldownEntry* FindEntry(FName CooldownKey) const;
+
+	/** Remove entries that have already expired */
+	void PruneExpired(double Now);
+};
@@ -13,6 +13,35 @@ class UGroundItemSubsystem;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogGroundItemPickupManager, Log, All);
 
+/**
+ * Outcome of one batched pickup request (server -> owning client)
+ */
+USTRUCT(BlueprintType)
+struct FGroundItemPickupResult
+{
+	GENERATED_BODY()
+
+	/** Client request this answers (INDEX_NONE for server-local pickups) */
+	UPROPERTY(BlueprintReadOnly, Category = "Pickup")
+	int32 RequestID = INDEX_NONE;
+
+	/** Ground IDs that went into the inventory */
+	UPROPERTY(BlueprintReadOnly, Category = "Pickup")
+	TArray<int32> PickedUpItemIDs;
+
+	/** IDs the client asked for */
+	UPROPERTY(BlueprintReadOnly, Category = "Pickup")
+	int32 NumRequested = 0;
+
+	/** Failed validation (gone, too far, no line of sight, throttled, over the batch cap) */
+	UPROPERTY(BlueprintReadOnly, Category = "Pickup")
+	int32 NumRejected = 0;
+
+	/** Valid but did not fit - left on the ground */
+	UPROPERTY(BlueprintReadOnly, Category = "Pickup")
+	int32 NumReturned = 0;
+};
+
 /**
  * Ground Item Pickup Manager
  * 
@@ -52,47 +81,96 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pickup")
 	bool bShowEquipHint;
 
+	/** Most items one "pickup all" request may carry (nearest first) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pickup", meta = (ClampMin = "1"))
+	int32 MaxBatchPickup;
+
 	// ═══════════════════════════════════════════════
 	// PRIMARY FUNCTIONS
 	// ═══════════════════════════════════════════════
 
 	/**
-	 * Pickup item to inventory (tap action)
+	 * Pickup item to inventory (tap action) - server / standalone only
 	 * @param ItemID - Ground item ID
-	 * @return True if pickup successful
+	 * @return True if pickup successful (always false without authority)
 	 */
 	bool PickupToInventory(int32 ItemID);
 
 	/**
-	 * Pickup item and equip immediately (hold action)
+	 * Pickup item and equip immediately (hold action) - server / standalone only
+	 * Items that can be neither equipped nor stored stay on the ground
 	 * @param ItemID - Ground item ID
-	 * @return True if pickup and equip successful
+	 * @return True if pickup and equip successful (always false without authority)
 	 */
 	bool PickupAndEquip(int32 ItemID);
 
 	/**
-	 * Pickup all items in radius around location
+	 * Pickup all items in radius around location (server / standalone, unvalidated)
 	 * @param Location - Center point for pickup
 	 * @return Number of items picked up
 	 */
 	int32 PickupAllNearby(FVector Location);
 
+	/**
+	 * IDs of items within PickupRadius, nearest first, capped at MaxBatchPickup
+	 * Works on clients (replicated items have IDs but no UItemInstance)
+	 * @return Number of IDs
+	 */
+	int32 GatherNearbyItemIDs(FVector Location, TArray<int32>& OutItemIDs) const;
+
+	/**
+	 * Server: move already validated items into the inventory as one transaction
+	 * One inventory batch insert, then one ground batch removal of what it accepted
+	 * Leftovers never leave the ground and keep their IDs
+	 * @param ItemIDs - Validated ground item IDs
+	 * @param OutResult - PickedUpItemIDs / NumReturned are filled
+	 */
+	void PickupItemsToInventory(const TArray<int32>& ItemIDs, FGroundItemPickupResult& OutResult);
+
+	// ═══════════════════════════════════════════════
+	// PREDICTION (CLIENT)
+	// ═══════════════════════════════════════════════
+
+	/**
+	 * Client: take items off the ground now and record the request for the server's answer
+	 * Items already in flight (or unknown) are dropped, so repeated clicks send nothing new
+	 * @param OutPredictedIDs - Items actually hidden - send these to the server
+	 * @return Request ID for the RPC, or INDEX_NONE if nothing is left to request
+	 */
+	int32 BeginPredictedPickup(const TArray<int32>& ItemIDs, TArray<int32>& OutPredictedIDs);
+
+	/**
+	 * Client: server answered - confirm what it picked up, put the rest back
+	 * @param OutRolledBackIDs - Predicted items the server refused
+	 */
+	void ResolvePredictedPickup(int32 RequestID, const TArray<int32>& PickedUpItemIDs, TArray<int32>& OutRolledBackIDs);
+
+	/**
+	 * Client: give up on requests the server has not answered within the ground
+	 * subsystem's PredictedRemovalTimeout and put their items back
+	 * @param OutRolledBackIDs - Items restored
+	 * @return Seconds until the next pending request expires (0 if none are left)
+	 */
+	float ExpirePredictedPickups(TArray<int32>& OutRolledBackIDs);
+
+	/** Items hidden locally and waiting for the server */
+	int32 GetNumPredictedItems() const;
+
 	// ═══════════════════════════════════════════════
 	// HOLD INTERACTION
 	// ═══════════════════════════════════════════════
 
 	/**
-	 * Start hold interaction for an item
+	 * Start hold interaction for an item (records the start time - nothing ticks)
 	 * @param ItemID - Ground item ID to track
 	 */
 	void StartHoldInteraction(int32 ItemID);
 
 	/**
-	 * Update hold progress
-	 * @param DeltaTime - Time since last update
-	 * @return True if hold completed (item was equipped)
+	 * End a hold that ran its full duration (caller equips - see UInteractionManager)
+	 * @return Item ID that was held, or -1 if not holding
 	 */
-	bool UpdateHoldProgress(float DeltaTime);
+	int32 CompleteHoldInteraction();
 
 	/**
 	 * Cancel current hold interaction
@@ -106,8 +184,8 @@ public:
 	/** Check if currently holding for ground item pickup */
 	FORCEINLINE bool IsHoldingForGroundItem() const { return bIsHoldingForGroundItem; }
 
-	/** Get current hold progress (0.0 - 1.0) */
-	FORCEINLINE float GetHoldProgress() const { return HoldProgress; }
+	/** Get current hold progress (0.0 - 1.0), computed from the start time */
+	float GetHoldProgress() const;
 
 	/** Get the item ID being held for */
 	FORCEINLINE int32 GetCurrentHoldItemID() const { return CurrentHoldItemID; }
@@ -138,6 +216,29 @@ private:
 
 	bool bIsHoldingForGroundItem;
 	int32 CurrentHoldItemID;
-	float HoldElapsedTime;
-	float HoldProgress;
+
+	/** World time the hold started (progress is derived on read) */
+	double HoldStartTime;
+
+	// ═══════════════════════════════════════════════
+	// PREDICTION STATE
+	// ═══════════════════════════════════════════════
+
+	/** Client request sent to the server and not yet answered */
+	struct FPredictedPickup
+	{
+		int32 RequestID = INDEX_NONE;
+		TArray<int32> ItemIDs;
+
+		/** World time the request was sent */
+		double StartTime = 0.0;
+	};
+
+	TArray<FPredictedPickup> PredictedPickups;
+
+	/**
+	 * Shared by every pickup manager in the process, so a respawned pawn on the same
+	 * connection never reuses an ID a late answer to its previous pawn still carries
+	 */
+	static int32 NextPickupRequestID;
 };
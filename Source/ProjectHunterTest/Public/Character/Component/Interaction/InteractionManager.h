@@ -22,6 +22,8 @@ DECLARE_LOG_CATEGORY_EXTERN(LogInteractionManager, Log, All);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCurrentInteractableChanged, UInteractableManager*, NewInteractable);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnGroundItemFocusChanged, int32, GroundItemID);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHoldProgressChanged, float, Progress);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnGroundItemsPickedUp, const FGroundItemPickupResult&, Result);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnGroundItemsPickupPredicted, const TArray<int32>&, ItemIDs);
 
 /**
  * Interaction Manager Component
@@ -145,10 +147,28 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Interaction|Events")
 	FOnGroundItemFocusChanged OnGroundItemFocusChanged;
 
-	/** Called when hold progress changes */
+	/**
+	 * Called when a ground item hold starts (0), completes (1) or is released (0)
+	 * Not per frame - poll GetCurrentHoldProgress while a progress UI is visible
+	 */
 	UPROPERTY(BlueprintAssignable, Category = "Interaction|Events")
 	FOnHoldProgressChanged OnHoldProgressChanged;
 
+	/** Called on the owning client when a pickup request is answered */
+	UPROPERTY(BlueprintAssignable, Category = "Interaction|Events")
+	FOnGroundItemsPickedUp OnGroundItemsPickedUp;
+
+	/**
+	 * Client: items left the ground ahead of the server - show them as pending in the inventory
+	 * They are already off the ground; read placeholders from UGroundItemSubsystem::GetPredictedItemDisplayInfo
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Interaction|Events")
+	FOnGroundItemsPickupPredicted OnGroundItemsPickupPending;
+
+	/** Client: the server refused these pending items - they are back on the ground */
+	UPROPERTY(BlueprintAssignable, Category = "Interaction|Events")
+	FOnGroundItemsPickupPredicted OnGroundItemsPickupRolledBack;
+
 	// ═══════════════════════════════════════════════
 	// PRIMARY INTERFACE
 	// ═══════════════════════════════════════════════
@@ -165,10 +185,30 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Interaction")
 	void PickupAllNearbyItems();
 
+	// ═══════════════════════════════════════════════
+	// NETWORK
+	// ═══════════════════════════════════════════════
+
+	/** Server RPC: pick up a batch of ground items in one transaction (RequestID is echoed back) */
+	UFUNCTION(Server, Reliable)
+	void ServerPickupItems(int32 RequestID, const TArray<int32>& ItemIDs);
+
+	/** Server RPC: pick up one ground item and equip it (hold); answered by ClientPickupItemsResult */
+	UFUNCTION(Server, Reliable)
+	void ServerPickupAndEquip(int32 RequestID, int32 ItemID);
+
+	/** Client RPC: consolidated result of ServerPickupItems / ServerPickupAndEquip */
+	UFUNCTION(Client, Reliable)
+	void ClientPickupItemsResult(const FGroundItemPickupResult& Result);
+
 	/** Check for interactables (called on timer) */
 	UFUNCTION(BlueprintCallable, Category = "Interaction")
 	void CheckForInteractables();
 
+	/** Scan next tick regardless of view motion (something changed nearby) */
+	UFUNCTION(BlueprintCallable, Category = "Interaction")
+	void RequestImmediateScan();
+
 	// ═══════════════════════════════════════════════
 	// WIDGET ACCESS
 	// ═══════════════════════════════════════════════
@@ -203,6 +243,7 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Interaction")
 	bool IsHoldingInteraction() const { return bIsHolding; }
 
+	/** Computed from the hold start time on each call */
 	UFUNCTION(BlueprintPure, Category = "Interaction")
 	float GetCurrentHoldProgress() const;
 
@@ -229,11 +270,66 @@ protected:
 	// ═══════════════════════════════════════════════
 
 	void InteractWithActor(AActor* TargetActor);
+
+	/** Server: distance / rate checks for an actor interaction (always true on clients) */
+	bool ValidateActorTarget(AActor* TargetActor);
 	void PickupGroundItemToInventory(int32 ItemID);
 	void PickupGroundItemAndEquip(int32 ItemID);
 	void UpdateFocusState(TScriptInterface<IInteractable> NewInteractable);
+
+	/** Next-tick half of an async scan: read the focus trace and finish */
+	void FinishAsyncScan();
+
+	/** Scan timer callback: check, then re-arm with the delay the check chose */
+	void RunScheduledScan();
+
+	/** (Re)arm the one-shot scan timer with TraceManager.GetNextScanDelay() */
+	void ScheduleNextScan();
+
+	/** Focus/widget update and debug for one scan result */
+	void FinishScan(const TScriptInterface<IInteractable>& NewInteractable, int32 NewGroundItemID);
+
+	/** Scored-candidate result -> FinishScan (latch applies to actors only) */
+	void FinishCandidateScan(const TScriptInterface<IInteractable>& NewInteractable, int32 NewGroundItemID);
+
+	/** Center-ray path: nearest ground item when the ray found no actor */
+	int32 FindGroundItemFallback(const TScriptInterface<IInteractable>& NewInteractable);
+
+	/**
+	 * Pick up ground items: directly with authority, otherwise predicted locally
+	 * and sent to the server (items already in flight are not re-sent)
+	 */
+	void RequestPickup(const TArray<int32>& ItemIDs);
+
+	/**
+	 * Client: hide items locally ahead of a pickup RPC and arm the expiry timer
+	 * @return Request ID to send, or INDEX_NONE if every item is already in flight
+	 */
+	int32 PredictPickup(const TArray<int32>& ItemIDs, TArray<int32>& OutPredictedIDs);
+
+	/** Client: roll back pickups the server never answered (timer, re-armed while any are pending) */
+	void ExpirePredictedPickups();
+
+	/** Server side of a batched pickup: cap, validate, then one pickup transaction */
+	void PickupItemsBatch(const TArray<int32>& ItemIDs, FGroundItemPickupResult& OutResult);
+
+	/** Apply a batched pickup result locally (focus + event) */
+	void HandlePickupResult(const FGroundItemPickupResult& Result);
+
+	/** Remote pawns skip BeginPlay setup - server RPCs initialize what they need */
+	void EnsureServerManagers();
+
+	/** Immediate-scan triggers (ground items and interactables appearing or going away) */
+	void BindScanTriggers();
+	void UnbindScanTriggers();
+	void OnGroundItemAdded(int32 ItemID, const FVector& Location);
+	void OnGroundItemRemoved(int32 ItemID, const FVector& Location);
+	void OnInteractableAvailable(UInteractableManager* Interactable);
+	void OnInteractableUnavailable(UInteractableManager* Interactable);
 	void UpdateGroundItemFocus(int32 NewGroundItemID);
-	void UpdateHoldProgress();
+
+	/** Hold timer elapsed - equip the held ground item */
+	void OnGroundItemHoldComplete();
 
 	// ═══════════════════════════════════════════════
 	// WIDGET MANAGEMENT
@@ -276,17 +372,26 @@ private:
 	/** Guard flag to prevent double initialization */
 	bool bSystemInitialized = false;
 
+	/** Validator + pickup manager ready for server RPCs */
+	bool bServerManagersInitialized = false;
+
 	/** Is currently in hold interaction? */
 	bool bIsHolding = false;
 
-	/** Last progress value (to avoid redundant updates) */
-	float LastHoldProgress = -1.0f;
+	/** An async scan is waiting on its traces (no new scan starts until it finishes) */
+	bool bAsyncScanInFlight = false;
 
 	// ═══════════════════════════════════════════════
 	// TIMERS
 	// ═══════════════════════════════════════════════
 
 	FTimerHandle InteractionCheckTimer;
-	FTimerHandle HoldProgressTimer;
+	FTimerHandle HoldCompleteTimer;
+	FTimerHandle PredictionExpiryTimer;
 	FTimerHandle PossessionCheckTimer;
+
+	FDelegateHandle GroundItemAddedHandle;
+	FDelegateHandle GroundItemRemovedHandle;
+	FDelegateHandle InteractableAvailableHandle;
+	FDelegateHandle InteractableUnavailableHandle;
 };
\ No newline at end of file
@@ -2,12 +2,16 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "WorldCollision.h"
+#include "UObject/WeakInterfacePtr.h"
 #include "InteractionTraceManager.generated.h"
 
 // Forward declarations
 class IInteractable;
 class UItemInstance;
 class UGroundItemSubsystem;
+class UInteractableRegistrySubsystem;
+class UInteractableManager;
 class APlayerController;
 class AALSPlayerCameraManager;
 struct FInteractionDebugManager;
@@ -37,6 +41,9 @@ public:
 	void Initialize(AActor* Owner, UWorld* World);
 	void SetDebugManager(FInteractionDebugManager* InDebugManager);
 
+	/** Release subsystem registrations (call from owner EndPlay) */
+	void Shutdown();
+
 	// ═══════════════════════════════════════════════
 	// CONFIGURATION
 	// ═══════════════════════════════════════════════
@@ -53,6 +60,96 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace")
 	TEnumAsByte<ECollisionChannel> InteractionTraceChannel;
 
+	/**
+	 * Skip the line trace when the interactable registry has nothing in range
+	 * (only actors with UInteractableManager are indexed - disable if
+	 * interface-only actors must be traceable)
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Registry")
+	bool bSkipTraceWhenNoneNearby;
+
+	/** Extra range for the registry pre-check (actor origin vs. the surface the trace hits) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Registry", meta = (EditCondition = "bSkipTraceWhenNoneNearby", ClampMin = "0.0"))
+	float RegistryQueryMargin;
+
+	/**
+	 * Issue the focus trace with AsyncLineTraceByChannel and read it next frame
+	 * (server validation keeps its synchronous traces)
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Async")
+	bool bUseAsyncTrace;
+
+	/** Keep the last focus this long after the trace starts missing it (stops flicker at edges) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Async", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float FocusLatchTime;
+
+	/**
+	 * Skip scans while the view is still and scan faster while it turns quickly
+	 * (CheckFrequency becomes the normal moving rate)
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Scheduling")
+	bool bAdaptiveScan;
+
+	/** View movement below this since the last scan counts as still (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Scheduling", meta = (EditCondition = "bAdaptiveScan", ClampMin = "0.0"))
+	float ScanMoveThreshold;
+
+	/** View rotation below this since the last scan counts as still (degrees) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Scheduling", meta = (EditCondition = "bAdaptiveScan", ClampMin = "0.0"))
+	float ScanRotationThreshold;
+
+	/** Turn rate that switches to FastScanInterval (degrees/second) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Scheduling", meta = (EditCondition = "bAdaptiveScan", ClampMin = "0.0"))
+	float FastRotationSpeed;
+
+	/** Scan interval during fast camera motion (also the shortest scan timer delay) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Scheduling", meta = (EditCondition = "bAdaptiveScan", ClampMin = "0.01"))
+	float FastScanInterval;
+
+	/** Longest gap between scans while still (backs off from CheckFrequency by doubling) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Scheduling", meta = (EditCondition = "bAdaptiveScan", ClampMin = "0.01"))
+	float IdleScanInterval;
+
+	/**
+	 * Pick focus from a scored broadphase over the interactable registry and
+	 * ground item grid (LOS traces only for the best few). When no candidate is
+	 * visible the center ray and nearest-ground-item fallback still run, so
+	 * actors implementing IInteractable without a UInteractableManager keep focus
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Candidates")
+	bool bUseCandidateScoring;
+
+	/** Half-angle of the view cone candidates must be inside (degrees) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Candidates", meta = (EditCondition = "bUseCandidateScoring", ClampMin = "1.0", ClampMax = "90.0"))
+	float FocusConeAngle;
+
+	/**
+	 * Half-angle of the ground item cone, measured on the horizontal plane only
+	 * (degrees) - items at the player's feet are far below the view cone
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Candidates", meta = (EditCondition = "bUseCandidateScoring", ClampMin = "1.0", ClampMax = "180.0"))
+	float GroundItemConeAngle;
+
+	/** Score weight for closeness to the view center */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Candidates", meta = (EditCondition = "bUseCandidateScoring", ClampMin = "0.0"))
+	float AngleWeight;
+
+	/** Score weight for closeness to the player */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Candidates", meta = (EditCondition = "bUseCandidateScoring", ClampMin = "0.0"))
+	float DistanceWeight;
+
+	/** Score weight for FocusPriority (interactables) / rarity (ground items) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Candidates", meta = (EditCondition = "bUseCandidateScoring", ClampMin = "0.0"))
+	float PriorityWeight;
+
+	/** Best-scoring candidates that get a line-of-sight trace per scan */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Candidates", meta = (EditCondition = "bUseCandidateScoring", ClampMin = "1", ClampMax = "8"))
+	int32 MaxLOSChecks;
+
+	/** LOS target height above a ground item's pivot (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|Candidates", meta = (EditCondition = "bUseCandidateScoring"))
+	float GroundItemLOSHeight;
+
 	/** Use ALS camera origin calculation */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace|ALS")
 	bool bUseALSCameraOrigin;
@@ -79,13 +176,94 @@ public:
 	 */
 	TScriptInterface<IInteractable> TraceForActorInteractable();
 
+	/**
+	 * Queue this scan's focus trace (result is ready next frame)
+	 * @return False if no trace was needed (nothing registered in range)
+	 */
+	bool RequestAsyncActorTrace();
+
+	/**
+	 * Read the trace queued by RequestAsyncActorTrace
+	 * Traces synchronously instead when the result was lost or waited on too long
+	 * @param OutInteractable - Latched result (only written when ready)
+	 * @return False if the trace is not finished yet (call again next tick)
+	 */
+	bool ConsumeAsyncActorTrace(TScriptInterface<IInteractable>& OutInteractable);
+
+	/**
+	 * Hold the last focus for FocusLatchTime through misses
+	 * @param Found - This scan's raw result
+	 * @return Found, or the latched interactable while the latch holds
+	 */
+	TScriptInterface<IInteractable> LatchFocus(const TScriptInterface<IInteractable>& Found);
+
+	/** Drop the latched focus (something else took focus) */
+	void ResetFocusLatch() { LatchedInteractable.Reset(); }
+
 	/**
 	 * Find nearest ground item within interaction distance
+	 * Uses the subsystem's batched proximity query (result is at most one batch old)
 	 * @param OutItemID - Output item ID
 	 * @return Item instance if found
 	 */
 	UItemInstance* FindNearestGroundItem(int32& OutItemID);
 
+	// ═══════════════════════════════════════════════
+	// CANDIDATE SCORING
+	// ═══════════════════════════════════════════════
+
+	/**
+	 * Broadphase + view-cone scoring over interactables and ground items
+	 * Actors are scored at the point of their collision bounds nearest the view
+	 * ray, so large or off-center actors are not judged by their origin
+	 * Keeps the best MaxLOSChecks, highest score first
+	 * @return Number of candidates kept
+	 */
+	int32 GatherFocusCandidates();
+
+	/**
+	 * LOS-check kept candidates best-first, stopping at the first clear one
+	 * @param OutInteractable - Winning actor interactable (empty if a ground item won)
+	 * @param OutGroundItemID - Winning ground item, or INDEX_NONE
+	 */
+	void ResolveFocusCandidates(TScriptInterface<IInteractable>& OutInteractable, int32& OutGroundItemID);
+
+	/**
+	 * Queue one async LOS trace per kept candidate
+	 * @return False if there is nothing to trace
+	 */
+	bool RequestCandidateTraces();
+
+	/**
+	 * Pick the best candidate whose async LOS trace came back clear
+	 * Traces synchronously instead when results were lost or waited on too long
+	 * @return False if the traces are not finished yet (call again next tick)
+	 */
+	bool ConsumeCandidateTraces(TScriptInterface<IInteractable>& OutInteractable, int32& OutGroundItemID);
+
+	// ═══════════════════════════════════════════════
+	// SCHEDULING
+	// ═══════════════════════════════════════════════
+
+	/** Delay to re-arm the owner's one-shot scan timer with (computed by ShouldScan) */
+	float GetNextScanDelay() const { return NextScanDelay > 0.0f ? NextScanDelay : CheckFrequency; }
+
+	/**
+	 * Decide whether this timer tick runs a scan (records the view when it does)
+	 * and when the next check is due: fast, normal or the idle back-off.
+	 * Always true with bAdaptiveScan off
+	 */
+	bool ShouldScan();
+
+	/**
+	 * Force the next ShouldScan to pass
+	 * @return False if a scan was already requested
+	 */
+	bool RequestScan();
+
+	/** Is a world location close enough to the last scanned view to change focus */
+	bool IsNearLastScan(const FVector& Location) const;
+
 	/**
 	 * Get camera view point with ALS-style offsets
 	 * @param OutLocation - Camera location
@@ -114,7 +292,45 @@ private:
 	FVector GetTraceStartLocation(const FVector& CameraLocation, const FRotator& CameraRotation) const;
 	FVector GetTraceEndLocation(const FVector& CameraLocation, const FRotator& CameraRotation) const;
 	bool PerformLineTrace(const FVector& Start, const FVector& End, FHitResult& OutHit);
-	bool IsActorInteractable(AActor* Actor) const;
+	FCollisionQueryParams MakeTraceQueryParams() const;
+
+	/** Camera -> trace endpoints, false if the registry says nothing is in range */
+	bool GetFocusTraceSegment(FVector& OutStart, FVector& OutEnd) const;
+
+	/** Resolve a finished hit and remember it as LastTraceResult */
+	TScriptInterface<IInteractable> ResolveTraceHit(bool bHit, const FHitResult& HitResult, const FVector& Start, const FVector& End);
+
+	/** Registry lookup (falls back to a component search when no registry exists) */
+	TScriptInterface<IInteractable> ResolveInteractable(AActor* Actor) const;
+
+	/** One broadphase result */
+	struct FFocusCandidate
+	{
+		TWeakObjectPtr<UInteractableManager> Interactable;
+		int32 GroundItemID = INDEX_NONE;
+		FVector Location = FVector::ZeroVector;
+		float Score = 0.0f;
+		FTraceHandle TraceHandle;
+	};
+
+	/**
+	 * Score a location against the view; false if outside cone or range
+	 * @param bHorizontalCone - Measure the cone angle on the XY plane only (ground items)
+	 */
+	bool ScoreCandidate(const FVector& Location, float Priority, float ConeAngle, bool bHorizontalCone, float& OutScore) const;
+
+	/** Point of an actor's collision bounds nearest the view ray (scored and LOS-traced) */
+	FVector GetActorAimPoint(const AActor* Actor, const FVector& Fallback) const;
+
+	/** LOS trace end point and params for a candidate */
+	FVector GetCandidateTraceTarget(const FFocusCandidate& Candidate) const;
+	FCollisionQueryParams MakeCandidateQueryParams(const FFocusCandidate& Candidate) const;
+
+	/** Is a finished LOS trace clear for this candidate (and is the candidate still alive) */
+	bool IsCandidateVisible(const FFocusCandidate& Candidate, bool bHit, const FHitResult& HitResult) const;
+
+	/** Write a winning candidate to the outputs */
+	void SelectCandidate(const FFocusCandidate& Candidate, TScriptInterface<IInteractable>& OutInteractable, int32& OutGroundItemID) const;
 
 	// ═══════════════════════════════════════════════
 	// CACHED REFERENCES
@@ -125,6 +341,7 @@ private:
 	APlayerController* CachedPlayerController;
 	AALSPlayerCameraManager* CachedALSCameraManager;
 	UGroundItemSubsystem* CachedGroundItemSubsystem;
+	UInteractableRegistrySubsystem* CachedInteractableRegistry;
 	FInteractionDebugManager* DebugManager;
 
 	// ═══════════════════════════════════════════════
@@ -132,4 +349,35 @@ private:
 	// ═══════════════════════════════════════════════
 
 	FHitResult LastTraceResult;
+
+	/** In-flight async focus trace */
+	FTraceHandle PendingTraceHandle;
+	FVector PendingTraceStart;
+	FVector PendingTraceEnd;
+
+	/** Ticks an async result has been waited on past the first */
+	int32 AsyncTraceWaitTicks;
+
+	/** Async results still missing after this many extra ticks are traced synchronously */
+	static constexpr int32 MaxAsyncTraceWaitTicks = 2;
+
+	/** Focus latch (weak - the interactable may be destroyed while latched) */
+	TWeakInterfacePtr<IInteractable> LatchedInteractable;
+	float LastFocusHitTime;
+
+	/** Candidate scan view + kept candidates (reused) */
+	FVector CandidateOrigin;
+	FVector CandidateForward;
+	TArray<FFocusCandidate> FocusCandidates;
+
+	/** View at the last scan (adaptive scheduling) */
+	FVector LastScanLocation;
+	FQuat LastScanRotation;
+	float LastScanTime;
+	float CurrentIdleInterval;
+	float NextScanDelay;
+	bool bScanRequested;
+
+	/** Handle into UGroundItemSubsystem batched proximity queries */
+	int32 GroundProximityQueryHandle;
 };
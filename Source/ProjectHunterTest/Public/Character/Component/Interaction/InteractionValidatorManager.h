@@ -2,17 +2,56 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
 #include "InteractionValidatorManager.generated.h"
 
 // Forward declarations
 class IInteractable;
 class UInteractableManager;
 class UGroundItemSubsystem;
+class UInteractableRegistrySubsystem;
 class AActor;
 class UWorld;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogInteractionValidatorManager, Log, All);
 
+/**
+ * Server validation counters (per player, since the validator was initialized)
+ */
+USTRUCT(BlueprintType)
+struct FInteractionValidationStats
+{
+	GENERATED_BODY()
+
+	/** Batched pickups count per item */
+	UPROPERTY(BlueprintReadOnly, Category = "Validation")
+	int32 Accepted = 0;
+
+	/** Dropped by the token bucket before any check ran */
+	UPROPERTY(BlueprintReadOnly, Category = "Validation")
+	int32 RejectedRateLimit = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Validation")
+	int32 RejectedDistance = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Validation")
+	int32 RejectedLineOfSight = 0;
+
+	/** Missing target / not interactable */
+	UPROPERTY(BlueprintReadOnly, Category = "Validation")
+	int32 RejectedState = 0;
+
+	/** Line-of-sight answers served from the cache */
+	UPROPERTY(BlueprintReadOnly, Category = "Validation")
+	int32 LOSCacheHits = 0;
+
+	/** Line-of-sight traces actually run */
+	UPROPERTY(BlueprintReadOnly, Category = "Validation")
+	int32 LOSTraces = 0;
+
+	int32 GetTotalRejected() const { return RejectedRateLimit + RejectedDistance + RejectedLineOfSight + RejectedState; }
+};
+
 /**
  * Manages the lifecycle and validation of interaction-related objects.
  * Responsible for ensuring interactions adhere to specific rules
@@ -54,6 +93,38 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Validation")
 	bool bLogValidationFailures = true;
 
+	/** Token bucket in front of every remote validation request (bounds server work per player; local players are never throttled) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Validation|RateLimit")
+	bool bRateLimitValidation = true;
+
+	/** Requests allowed back-to-back before throttling */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Validation|RateLimit", meta = (EditCondition = "bRateLimitValidation", ClampMin = "1.0"))
+	float ValidationBurst = 10.0f;
+
+	/** Sustained requests per second */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Validation|RateLimit", meta = (EditCondition = "bRateLimitValidation", ClampMin = "0.1"))
+	float ValidationRefillRate = 5.0f;
+
+	/** Reuse a line-of-sight answer for the same target this long (0 = never cache) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Validation|LineOfSight", meta = (ClampMin = "0.0"))
+	float LOSCacheLifetime = 0.25f;
+
+	/** Cached answer is dropped if either end moved further than this (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Validation|LineOfSight", meta = (ClampMin = "0.0"))
+	float LOSCacheMoveTolerance = 25.0f;
+
+	/** Cached targets kept per player */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Validation|LineOfSight", meta = (ClampMin = "1"))
+	int32 MaxLOSCacheEntries = 32;
+
+	/** Batched pickups share one line-of-sight trace per cell of this size (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Validation|LineOfSight", meta = (ClampMin = "10.0"))
+	float PickupClusterSize = 200.0f;
+
+	/** Batch traces aim this far above the cluster centroid so the floor doesn't block them (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Validation|LineOfSight", meta = (ClampMin = "0.0"))
+	float GroundItemLOSHeight = 10.0f;
+
 	// ═══════════════════════════════════════════════
 	// INITIALIZATION
 	// ═══════════════════════════════════════════════
@@ -79,6 +150,15 @@ public:
 	 */
 	bool ValidateGroundItemPickup(int32 ItemID, FVector ClientLocation, float MaxDistance);
 
+	/**
+	 * Validate a batched ground item pickup (one rate-limit token for the whole request)
+	 * Distance is checked per item, line of sight once per PickupClusterSize cell
+	 * @param ItemIDs - Requested IDs (duplicates ignored)
+	 * @param OutValidIDs - IDs that passed
+	 * @return Number of valid IDs
+	 */
+	int32 ValidateGroundItemBatch(const TArray<int32>& ItemIDs, FVector ClientLocation, float MaxDistance, TArray<int32>& OutValidIDs);
+
 	/**
 	 * Check if actor can be interacted with
 	 */
@@ -99,6 +179,21 @@ public:
 	 */
 	bool HasLineOfSight(FVector Start, FVector End, AActor* SourceActor = nullptr, AActor* TargetActor = nullptr);
 
+	/**
+	 * Take one token from the request bucket (requests from a local player are free)
+	 * @return False if the player is over the rate limit (counted in stats)
+	 */
+	bool ConsumeValidationToken();
+
+	/** True if the owner is driven over a remote connection (only those are rate limited) */
+	bool IsRemoteRequester() const;
+
+	/** Counters for monitoring / anti-cheat */
+	const FInteractionValidationStats& GetValidationStats() const { return Stats; }
+
+	/** Drop cached line-of-sight answers (e.g. after level geometry changes) */
+	void ClearLineOfSightCache() { LOSCache.Reset(); }
+
 	/**
 	 * Calculate dynamic latency buffer based on player ping
 	 */
@@ -127,14 +222,47 @@ private:
 	AActor* OwnerActor = nullptr;
 	UWorld* WorldContext = nullptr;
 	UGroundItemSubsystem* CachedGroundItemSubsystem = nullptr;
+	UInteractableRegistrySubsystem* CachedInteractableRegistry = nullptr;
 
 	// Anti-cheat tracking
 	int32 ValidationFailureCount = 0;
 	float LastValidationFailureTime = 0.0f;
 
+	FInteractionValidationStats Stats;
+
+	// Token bucket
+	float ValidationTokens = 0.0f;
+	float LastTokenRefillTime = 0.0f;
+	bool bRateLimited = false;
+
+	/** Who looked at what - the viewer's location is matched against Entry.Start */
+	struct FLOSCacheKey
+	{
+		TObjectKey<AActor> Source;
+		TObjectKey<AActor> Target;
+
+		bool operator==(const FLOSCacheKey& Other) const { return Source == Other.Source && Target == Other.Target; }
+		friend uint32 GetTypeHash(const FLOSCacheKey& Key) { return HashCombine(GetTypeHash(Key.Source), GetTypeHash(Key.Target)); }
+	};
+
+	/** One cached trace per (viewer, target) */
+	struct FLOSCacheEntry
+	{
+		FVector Start = FVector::ZeroVector;
+		FVector End = FVector::ZeroVector;
+		float Time = 0.0f;
+		bool bClear = false;
+	};
+
+	TMap<FLOSCacheKey, FLOSCacheEntry> LOSCache;
+
 	// ═══════════════════════════════════════════════
 	// INTERNAL HELPERS
 	// ═══════════════════════════════════════════════
 
 	void CacheComponents();
+
+	/** Cached answer for this viewer and target if still fresh and neither end moved */
+	const FLOSCacheEntry* FindCachedLineOfSight(const AActor* SourceActor, const AActor* TargetActor, const FVector& Start, const FVector& End, float Now) const;
+	void StoreLineOfSight(const AActor* SourceActor, const AActor* TargetActor, const FVector& Start, const FVector& End, float Now, bool bClear);
 };
\ No newline at end of file
@@ -111,6 +111,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	bool AddItemToSlot(UItemInstance* Item, int32 SlotIndex);
 
+	/**
+	 * Add several items with one inventory/weight broadcast (batched pickups)
+	 * @param InItems - Items to add, in order
+	 * @param OutRejected - Items that did not fit (appended)
+	 * @return Number of items added
+	 */
+	int32 AddItems(const TArray<UItemInstance*>& InItems, TArray<UItemInstance*>& OutRejected);
+
 	/**
 	 * Remove item from inventory
 	 * @param Item - Item to remove
@@ -364,5 +372,9 @@ private:
 
 	/** Remove all null/invalid items */
 	void CleanupInvalidItems();
+
+	/** AddItems in progress - change broadcasts wait until it ends */
+	bool bDeferChangeBroadcasts = false;
+	bool bChangeBroadcastPending = false;
 };
 
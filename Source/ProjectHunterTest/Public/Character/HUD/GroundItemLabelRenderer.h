@@ -0,0 +1,149 @@
+// Character/HUD/GroundItemLabelRenderer.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Item/Library/ItemEnums.h"
+#include "GroundItemLabelRenderer.generated.h"
+
+// Forward declarations
+class UCanvas;
+class UFont;
+class UGroundItemSubsystem;
+
+/**
+ * Ground item label tuning (set on the HUD)
+ */
+USTRUCT(BlueprintType)
+struct FGroundItemLabelSettings
+{
+	GENERATED_BODY()
+
+	/** Hard cap on labels drawn per frame */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0"))
+	int32 MaxLabels = 40;
+
+	/** Items further than this from the camera get no label (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0"))
+	float MaxDistance = 2500.0f;
+
+	/** Items below this rarity get no label */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	EItemRarity MinRarity = EItemRarity::IR_None;
+
+	/** Label anchor height above the item (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float HeightOffset = 30.0f;
+
+	/** Space kept between labels and around text (px) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0"))
+	float Padding = 3.0f;
+
+	/** Times a colliding label is nudged upward before it is dropped */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0"))
+	int32 MaxNudges = 3;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.1"))
+	float TextScale = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FLinearColor BackgroundColor = FLinearColor(0.0f, 0.0f, 0.0f, 0.6f);
+
+	/** Label collapsed piles ("12 items") instead of the items inside them */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bLabelPiles = true;
+};
+
+/**
+ * FGroundItemLabelRenderer - Batched nameplates for ground items
+ *
+ * SINGLE RESPONSIBILITY: Pick, lay out and draw ground item labels on one canvas
+ *
+ * PER FRAME:
+ * 1. Gather items near the camera from UGroundItemSubsystem's spatial grid
+ * 2. Project once, reject off-screen / behind-camera
+ * 3. Sort by rarity (highest first), then distance
+ * 4. Greedy layout - colliding labels are nudged up, then dropped
+ * 5. Draw everything through the HUD canvas (no widgets)
+ *
+ * OPTIMIZATION:
+ * - Cost is bounded by items in range, not items on the floor
+ * - Label text and its measured size are cached per item ID and pruned
+ *   to the labels actually drawn; an entry is rebuilt when the item's name
+ *   or stack count no longer matches what it was built from
+ * - Layout stops at MaxLabels
+ */
+struct PROJECTHUNTERTEST_API FGroundItemLabelRenderer
+{
+public:
+	FGroundItemLabelRenderer();
+
+	void Initialize(UWorld* World);
+
+	/** Gather, project, sort and lay out this frame's labels (call from DrawHUD) */
+	void Update(UCanvas* Canvas, UFont* Font, const FVector& ViewLocation, const FGroundItemLabelSettings& Settings);
+
+	/** Draw the labels laid out by the last Update */
+	void Draw(UCanvas* Canvas, UFont* Font, const FGroundItemLabelSettings& Settings) const;
+
+	/** Drop all labels and cached text */
+	void Reset();
+
+	/**
+	 * Label under a screen point (hover / click to pick up)
+	 * @return Item ID, or INDEX_NONE (also for pile labels)
+	 */
+	int32 FindItemAtScreenPosition(const FVector2D& ScreenPosition) const;
+
+	int32 GetNumLabels() const { return Labels.Num(); }
+
+private:
+	struct FCandidate
+	{
+		/** INDEX_NONE for piles */
+		int32 ItemID = INDEX_NONE;
+		int32 PileCount = 0;
+		FVector Location = FVector::ZeroVector;
+		FVector2D ScreenPosition = FVector2D::ZeroVector;
+		float DistanceSq = 0.0f;
+		EItemRarity Rarity = EItemRarity::IR_None;
+	};
+
+	struct FCachedText
+	{
+		FText Text;
+		FVector2D Size = FVector2D::ZeroVector;
+
+		/** What Text was built from (rebuilt when either changes) */
+		FText SourceName;
+		int32 SourceQuantity = 0;
+	};
+
+	struct FLabel
+	{
+		int32 ItemID = INDEX_NONE;
+		FBox2D Bounds = FBox2D(ForceInit);
+		FText Text;
+		FLinearColor Color = FLinearColor::White;
+	};
+
+	void GatherCandidates(UGroundItemSubsystem* Subsystem, UCanvas* Canvas, const FVector& ViewLocation, const FGroundItemLabelSettings& Settings);
+
+	/** Add a candidate if it projects on screen */
+	void AddCandidate(FCandidate&& Candidate, UCanvas* Canvas, const FGroundItemLabelSettings& Settings);
+
+	/** Cached text for an item (built + measured on first use or when the item changed) */
+	const FCachedText& GetItemText(UGroundItemSubsystem* Subsystem, int32 ItemID, EItemRarity Rarity, UCanvas* Canvas, UFont* Font, float Scale);
+
+	bool OverlapsPlaced(const FBox2D& Bounds) const;
+
+	UWorld* WorldContext;
+
+	/** Reused every frame */
+	TArray<FCandidate> Candidates;
+
+	TArray<FLabel> Labels;
+
+	/** ItemID -> text (pruned to last frame's labels) */
+	TMap<int32, FCachedText> TextCache;
+	TMap<int32, FCachedText> NextTextCache;
+};
@@ -4,9 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/HUD.h"
+#include "Character/HUD/GroundItemLabelRenderer.h"
 #include "HunterHUD.generated.h"
 
 class UItemTooltipWidget;
+class UFont;
 /**
  * 
  */
@@ -24,12 +26,34 @@ public:
 	void ShowMashProgressWidget(const FText& Text, int32 INT32);
 	void HideMashProgressWidget();
 
+	// Ground item labels
+	UFUNCTION(BlueprintCallable)
+	void SetGroundItemLabelsVisible(bool bVisible);
+
+	/** Ground item under a label at this screen point, or INDEX_NONE */
+	UFUNCTION(BlueprintPure)
+	int32 GetGroundItemLabelAt(FVector2D ScreenPosition) const { return GroundItemLabels.FindItemAtScreenPosition(ScreenPosition); }
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void DrawHUD() override;
     
 	UPROPERTY(EditDefaultsOnly, Category = "UI")
 	TSubclassOf<UItemTooltipWidget> ItemTooltipWidgetClass;
     
 	UPROPERTY()
 	UItemTooltipWidget* ItemTooltipWidget;
+
+	UPROPERTY(EditDefaultsOnly, Category = "UI|Ground Item Labels")
+	bool bShowGroundItemLabels = true;
+
+	UPROPERTY(EditDefaultsOnly, Category = "UI|Ground Item Labels")
+	FGroundItemLabelSettings GroundItemLabelSettings;
+
+	/** Null = engine small font */
+	UPROPERTY(EditDefaultsOnly, Category = "UI|Ground Item Labels")
+	UFont* GroundItemLabelFont = nullptr;
+
+	/** All ground item nameplates, drawn in one canvas pass */
+	FGroundItemLabelRenderer GroundItemLabels;
 };
@@ -15,6 +15,7 @@ class UHunterAttributeSet;
 class UCharacterProgressionManager;
 class UEquipmentManager;
 class UStatsManager;
+class UConsumableCooldownManager;
 class UBaseStatsData;
 class UGameplayEffect;
 class UGameplayAbility;
@@ -61,6 +62,10 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
 	TObjectPtr<UStatsManager> StatsManager;
 
+	/** Consumable Cooldown Manager - Timestamp cooldowns per group */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Consumable")
+	TObjectPtr<UConsumableCooldownManager> ConsumableCooldownManager;
+
 	/**
 	 * Base stats data asset
 	 * Defines starting attribute values for this character
@@ -102,6 +107,12 @@ public:
 		return StatsManager;
 	}
 
+	UFUNCTION(BlueprintPure, Category = "Consumable")
+	UConsumableCooldownManager* GetConsumableCooldownManager() const
+	{
+		return ConsumableCooldownManager;
+	}
+
 	/* ═══════════════════════════════════════════════════════════════════════ */
 	/* CHARACTER INFO */
 	/* ═══════════════════════════════════════════════════════════════════════ */
@@ -9,6 +9,7 @@
 
 class UWidgetComponent;
 class UInteractableWidget;
+enum class EInteractionWidgetState : uint8;
 
 // Delegate for Blueprint events
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInteractionEvent, AActor*, Interactor);
@@ -74,7 +75,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction|Widget")
 	bool bAlwaysFaceCamera = true;
 
-	/** How often to update widget rotation (seconds). Lower = smoother but more expensive. 0 = only update at key moments */
+	/**
+	 * How often to update widget rotation (seconds). 0 = only update at key moments.
+	 * Updates run in UInteractableBillboardSubsystem's per-frame batch, so anything
+	 * below the frame time means every frame (while on screen and in range)
+	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction|Widget", 
 		meta = (EditCondition = "bAlwaysFaceCamera", ClampMin = "0.0", ClampMax = "1.0"))
 	float CameraFacingUpdateRate = 0.05f;
@@ -187,13 +192,50 @@ public:
 	void UpdateProgress(float Progress, bool bIsDepleting = false);
 	void SetProgressBarVisible(bool bVisible);
 
+	// ═══════════════════════════════════════════════════════════════════════
+	// HOLD / MASH PROGRESS (timestamp-driven - no per-frame cost)
+	// ═══════════════════════════════════════════════════════════════════════
+
+	/** Start a hold: progress is derived from the start time, completion is a single timer */
+	UFUNCTION(BlueprintCallable, Category = "Interaction|Hold")
+	void BeginHold(AActor* Interactor);
+
+	/** Button released before completion (cancels only if Config.bCanCancelHold - focus loss always cancels) */
+	UFUNCTION(BlueprintCallable, Category = "Interaction|Hold")
+	void ReleaseHold(AActor* Interactor);
+
+	/** Hold progress [0-1] from elapsed time (0 when not holding) */
+	UFUNCTION(BlueprintPure, Category = "Interaction|Hold")
+	float GetHoldProgress() const;
+
+	UFUNCTION(BlueprintPure, Category = "Interaction|Hold")
+	bool IsHoldActive() const { return bHoldActive; }
+
+	/**
+	 * One mash press: decay the running count to now, add one, then complete
+	 * or reschedule the single "decayed to zero" timer
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Interaction|Mash")
+	void RegisterMashPress(AActor* Interactor);
+
+	/** Stop mashing without completing (no fail event) */
+	UFUNCTION(BlueprintCallable, Category = "Interaction|Mash")
+	void CancelMash();
+
+	/** Decayed mash count / required [0-1], evaluated on read */
+	UFUNCTION(BlueprintPure, Category = "Interaction|Mash")
+	float GetMashProgress() const;
+
+	UFUNCTION(BlueprintPure, Category = "Interaction|Mash")
+	bool IsMashActive() const { return bMashActive; }
+
 	// ═══════════════════════════════════════════════════════════════════════
 	// BLUEPRINT CALLABLE
 	// ═══════════════════════════════════════════════════════════════════════
 	
 	/** Enable/disable interaction */
 	UFUNCTION(BlueprintCallable, Category = "Interaction")
-	void SetCanInteract(bool bNewCanInteract) { Config.bCanInteract = bNewCanInteract; }
+	void SetCanInteract(bool bNewCanInteract);
 
 	/** Update interaction text */
 	UFUNCTION(BlueprintCallable, Category = "Interaction")
@@ -217,6 +259,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Interaction|Widget")
 	void SetCameraFacingEnabled(bool bEnabled);
 
+	/** Widget component (null until BeginPlay) */
+	UWidgetComponent* GetWidgetComponent() const { return WidgetComponent; }
+
+	/**
+	 * Turn the widget toward a camera (called by UInteractableBillboardSubsystem)
+	 * @param CameraLocation - World location to face
+	 * @param DeltaTime - Time since the last update (0 for instant)
+	 */
+	void UpdateBillboard(const FVector& CameraLocation, float DeltaTime);
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
@@ -234,9 +286,6 @@ private:
 	UPROPERTY()
 	AActor* CurrentInteractor = nullptr;
 
-	/** Timer handle for camera-facing updates */
-	FTimerHandle CameraFacingTimerHandle;
-
 	/** Create and setup widget component */
 	void CreateWidgetComponent();
 
@@ -266,14 +315,68 @@ private:
 	 */
 	bool GetInteractorCamera(AActor* Interactor, FVector& OutCameraLocation, FRotator& OutCameraRotation) const;
 
-	/** Start camera-facing update timer */
+	/** Register with the billboard subsystem for continuous updates */
 	void StartCameraFacingUpdates();
 
-	/** Stop camera-facing update timer */
+	/** Unregister from the billboard subsystem */
 	void StopCameraFacingUpdates();
 
-	/** Timer callback for continuous camera-facing updates */
-	void UpdateCameraFacingTimer();
+	/** Show/hide the widget; hidden widgets stop ticking and leave the billboard batch */
+	void SetWidgetShown(bool bShown);
+
+	// ═══════════════════════════════════════════════════════════════════════
+	// HOLD / MASH STATE
+	// ═══════════════════════════════════════════════════════════════════════
+
+	/** Actor driving the active hold or mash */
+	UPROPERTY()
+	AActor* ProgressInteractor = nullptr;
+
+	bool bHoldActive = false;
+
+	/** World time the hold started */
+	double HoldStartTime = 0.0;
+
+	/** Hold length captured at start (GetHoldDuration may be overridden) */
+	float ActiveHoldDuration = 0.0f;
+
+	FTimerHandle HoldCompleteTimerHandle;
+
+	bool bMashActive = false;
+
+	/**
+	 * Mash count as of MashValueTime; decay since then is applied on read.
+	 * Decay is linear, so one (count, time) pair is exact - no press history needed
+	 */
+	float MashValue = 0.0f;
+	double MashValueTime = 0.0;
+
+	/** Required count / decay rate captured on the first press (both may be overridden) */
+	int32 ActiveMashRequired = 1;
+	float ActiveMashDecayRate = 0.0f;
+
+	/** Fires when MashValue would decay to zero (rescheduled on each press) */
+	FTimerHandle MashDecayTimerHandle;
+
+	/** Hold timer elapsed */
+	void OnHoldTimerComplete();
+
+	/** End an active hold without completing, whatever bCanCancelHold says */
+	void CancelHold(AActor* Interactor);
+
+	/** Mash count reached zero without a press */
+	void OnMashDecayedOut();
+
+	/** MashValue decayed to Now */
+	float GetDecayedMashValue(double Now) const;
+
+	/** Put the widget into Holding/Mashing and let it sample the matching getter */
+	void BindWidgetProgress(bool bMash);
+
+	/** Widget state after a hold/mash ends */
+	void SetWidgetProgressState(EInteractionWidgetState NewState);
+
+	double GetWorldTime() const;
 
 	// ═══════════════════════════════════════════════════════════════════════
 	// MESH MANAGEMENT
@@ -288,6 +288,10 @@ struct FInteractionConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction")
 	bool bCanInteract = true;
 
+	/** Focus tie-breaker when several interactables are in view (higher wins) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float FocusPriority = 0.0f;
+
 	FInteractionConfig() = default;
 };
 /**
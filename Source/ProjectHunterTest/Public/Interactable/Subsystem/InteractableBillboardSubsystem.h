@@ -0,0 +1,96 @@
+// Interactable/Subsystem/InteractableBillboardSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "InteractableBillboardSubsystem.generated.h"
+
+// Forward declarations
+class UInteractableManager;
+
+/**
+ * UInteractableBillboardSubsystem - Turns visible interactable widgets toward the camera
+ *
+ * SINGLE RESPONSIBILITY: One per-frame pass over the interactable widgets that are
+ * currently shown, instead of one looping timer per UInteractableManager
+ *
+ * DESIGN:
+ * - UInteractableManager registers when its widget is shown, unregisters when hidden
+ * - Local player views are read once per frame and shared by every widget
+ * - Widgets out of range or outside the view cone are skipped; their elapsed time
+ *   carries over so smoothing catches up when they come back on screen
+ * - Does not tick at all while nothing is registered
+ *
+ * The view cone is used instead of WasRecentlyRendered: a widget turned edge-on
+ * stops rendering and would never be turned back.
+ */
+UCLASS()
+class PROJECTHUNTERTEST_API UInteractableBillboardSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ═══════════════════════════════════════════════
+	// SUBSYSTEM LIFECYCLE
+	// ═══════════════════════════════════════════════
+
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Billboards.Num() > 0; }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UInteractableBillboardSubsystem, STATGROUP_Tickables); }
+
+	// ═══════════════════════════════════════════════
+	// REGISTRATION
+	// ═══════════════════════════════════════════════
+
+	/** Called when an interactable's widget is shown (idempotent) */
+	void Register(UInteractableManager* Interactable);
+
+	/** Called when an interactable's widget is hidden or the interactable ends play */
+	void Unregister(UInteractableManager* Interactable);
+
+	UFUNCTION(BlueprintPure, Category = "Interaction|Billboard")
+	int32 GetNumRegistered() const { return Billboards.Num(); }
+
+	/** Widgets turned by the last Tick (on screen and in range) */
+	UFUNCTION(BlueprintPure, Category = "Interaction|Billboard")
+	int32 GetNumUpdatedLastFrame() const { return NumUpdatedLastFrame; }
+
+	// ═══════════════════════════════════════════════
+	// SETTINGS
+	// ═══════════════════════════════════════════════
+
+	/** Widgets farther than this from every local camera are not turned (cm) */
+	UPROPERTY(BlueprintReadWrite, Category = "Interaction|Billboard", meta = (ClampMin = "0.0"))
+	float MaxBillboardDistance = 5000.0f;
+
+	/** Degrees added to the camera's half FOV before a widget counts as off screen */
+	UPROPERTY(BlueprintReadWrite, Category = "Interaction|Billboard", meta = (ClampMin = "0.0", ClampMax = "90.0"))
+	float ViewConeMargin = 10.0f;
+
+private:
+	struct FBillboardEntry
+	{
+		TWeakObjectPtr<UInteractableManager> Interactable;
+
+		/** Time since this widget was last turned */
+		float PendingTime = 0.0f;
+	};
+
+	struct FBillboardView
+	{
+		FVector Location = FVector::ZeroVector;
+		FVector Forward = FVector::ForwardVector;
+		float CosHalfCone = 0.0f;
+	};
+
+	/** Gather every local player's view point (usually one) */
+	void GatherViews(TArray<FBillboardView, TInlineAllocator<4>>& OutViews) const;
+
+	/** Registered widgets (order is not significant) */
+	TArray<FBillboardEntry> Billboards;
+
+	int32 NumUpdatedLastFrame = 0;
+};
@@ -0,0 +1,152 @@
+// Interactable/Subsystem/InteractableRegistrySubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/SceneComponent.h"
+#include "Tower/Subsystem/GroundItemSpatialGrid.h"
+#include "UObject/ObjectKey.h"
+#include "InteractableRegistrySubsystem.generated.h"
+
+// Forward declarations
+class IInteractable;
+class UInteractableManager;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogInteractableRegistry, Log, All);
+
+/** Native only - an interactable appeared or became usable */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnInteractableAvailable, UInteractableManager* /*Interactable*/);
+
+/** Native only - an interactable is going away or stopped being usable */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnInteractableUnavailable, UInteractableManager* /*Interactable*/);
+
+/**
+ * UInteractableRegistrySubsystem - Live set of interactables in the world
+ *
+ * SINGLE RESPONSIBILITY: Answer "which interactable is this actor" and
+ * "which interactables are near this point" without walking components
+ *
+ * DESIGN:
+ * - UInteractableManager registers on BeginPlay, unregisters on EndPlay
+ * - Actor -> interactable is one hash lookup (replaces FindComponentByClass)
+ * - Spatial index reuses FGroundItemSpatialGrid keyed by registry handle
+ * - Movable owners are re-bucketed from their root's TransformUpdated event,
+ *   static ones never pay for it
+ *
+ * Actors implementing IInteractable directly (no component) are not indexed;
+ * ResolveInteractable still finds them through the interface check.
+ */
+UCLASS()
+class PROJECTHUNTERTEST_API UInteractableRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UInteractableRegistrySubsystem();
+
+	// ═══════════════════════════════════════════════
+	// SUBSYSTEM LIFECYCLE
+	// ═══════════════════════════════════════════════
+
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override { return true; }
+
+	// ═══════════════════════════════════════════════
+	// REGISTRATION
+	// ═══════════════════════════════════════════════
+
+	/** Called by UInteractableManager::BeginPlay (idempotent) */
+	void Register(UInteractableManager* Interactable);
+
+	/** Called by UInteractableManager::EndPlay */
+	void Unregister(UInteractableManager* Interactable);
+
+	/** Called when a registered interactable is re-enabled (SetCanInteract) */
+	void NotifyInteractableEnabled(UInteractableManager* Interactable);
+
+	/** Called when a registered interactable is disabled (SetCanInteract) */
+	void NotifyInteractableDisabled(UInteractableManager* Interactable);
+
+	/** Fires on Register and NotifyInteractableEnabled (scanners re-check focus) */
+	FOnInteractableAvailable OnInteractableAvailable;
+
+	/** Fires on Unregister and NotifyInteractableDisabled (scanners drop stale focus) */
+	FOnInteractableUnavailable OnInteractableUnavailable;
+
+	// ═══════════════════════════════════════════════
+	// LOOKUP
+	// ═══════════════════════════════════════════════
+
+	/** Registered component on this actor, or null (O(1)) */
+	UFUNCTION(BlueprintPure, Category = "Interaction|Registry")
+	UInteractableManager* FindInteractable(const AActor* Actor) const;
+
+	/**
+	 * Interactable for a hit actor: registered component first, then the actor's own interface
+	 * @return Empty if the actor is not interactable
+	 */
+	TScriptInterface<IInteractable> ResolveInteractable(AActor* Actor) const;
+
+	// ═══════════════════════════════════════════════
+	// SPATIAL QUERIES
+	// ═══════════════════════════════════════════════
+
+	/**
+	 * All registered interactables whose owner is within Radius
+	 * @return Number found (OutInteractables is appended)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Interaction|Registry")
+	int32 GetInteractablesInRadius(FVector Location, float Radius, TArray<UInteractableManager*>& OutInteractables) const;
+
+	/** Nearest registered interactable within MaxDistance, or null */
+	UFUNCTION(BlueprintCallable, Category = "Interaction|Registry")
+	UInteractableManager* FindNearestInteractable(FVector Location, float MaxDistance) const;
+
+	/** Cheap "anything here?" test (nearest search, no output array) */
+	bool HasInteractableInRadius(const FVector& Location, float Radius) const;
+
+	/**
+	 * Visit every live registered interactable within Radius (no output array)
+	 * @param Visitor - void(UInteractableManager* Interactable, const FVector& Location)
+	 */
+	template<typename FuncType>
+	void ForEachInRadius(const FVector& Location, float Radius, FuncType&& Visitor) const
+	{
+		SpatialIndex.ForEachInRadius(Location, Radius, [this, &Visitor](int32 Handle, const FVector& EntryLocation)
+		{
+			if (UInteractableManager* Interactable = Entries[Handle].Interactable.Get())
+			{
+				Visitor(Interactable, EntryLocation);
+			}
+		});
+	}
+
+	UFUNCTION(BlueprintPure, Category = "Interaction|Registry")
+	int32 GetNumRegistered() const { return Entries.Num(); }
+
+	/** Cell edge length of the spatial index (cm) */
+	static constexpr float CellSize = 1000.0f;
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<UInteractableManager> Interactable;
+		TWeakObjectPtr<USceneComponent> Root;
+		FVector Location = FVector::ZeroVector;
+		FDelegateHandle TransformHandle;
+	};
+
+	/** Root moved - keep the spatial index in step */
+	void OnRootTransformUpdated(USceneComponent* Root, EUpdateTransformFlags Flags, ETeleportType Teleport, int32 Handle);
+
+	void RemoveEntry(int32 Handle);
+
+	/** Handle -> entry (handles are reused after unregister) */
+	TSparseArray<FEntry> Entries;
+
+	/** Actor -> handle */
+	TMap<TObjectKey<AActor>, int32> ActorToHandle;
+
+	/** Handle buckets by owner location */
+	FGroundItemSpatialGrid SpatialIndex;
+};
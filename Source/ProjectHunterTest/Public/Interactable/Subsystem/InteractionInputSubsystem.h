@@ -0,0 +1,119 @@
+// Interactable/Subsystem/InteractionInputSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/LocalPlayerSubsystem.h"
+#include "InputCoreTypes.h"
+#include "UObject/ObjectKey.h"
+#include "InteractionInputSubsystem.generated.h"
+
+// Forward declarations
+class UInputAction;
+class UEnhancedInputLocalPlayerSubsystem;
+class FInteractionInputProcessor;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogInteractionInput, Log, All);
+
+/**
+ * EInteractionInputDevice - Which device the player last used
+ */
+UENUM(BlueprintType)
+enum class EInteractionInputDevice : uint8
+{
+	IID_KeyboardMouse   UMETA(DisplayName = "Keyboard & Mouse"),
+	IID_Gamepad         UMETA(DisplayName = "Gamepad")
+};
+
+/** Native only - the player switched between keyboard/mouse and gamepad */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnInteractionInputDeviceChanged, EInteractionInputDevice /*NewDevice*/);
+
+/** Native only - mapping contexts were added, removed or remapped */
+DECLARE_MULTICAST_DELEGATE(FOnInteractionKeyBindingsChanged);
+
+/**
+ * UInteractionInputSubsystem - Current input device and action -> key table for prompts
+ *
+ * SINGLE RESPONSIBILITY: Tell interaction prompts which key to show, and when that changes
+ *
+ * DESIGN:
+ * - Device type comes from a Slate input pre-processor (sees every key, analog and mouse
+ *   event once), so nothing polls key state
+ * - The action -> key table is filled lazily per action from Enhanced Input's active
+ *   mappings and dropped when its control mappings are rebuilt
+ * - Widgets bind OnInputDeviceChanged / OnKeyBindingsChanged and refresh only then
+ */
+UCLASS()
+class PROJECTHUNTERTEST_API UInteractionInputSubsystem : public ULocalPlayerSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ═══════════════════════════════════════════════
+	// SUBSYSTEM LIFECYCLE
+	// ═══════════════════════════════════════════════
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// ═══════════════════════════════════════════════
+	// INPUT DEVICE
+	// ═══════════════════════════════════════════════
+
+	UFUNCTION(BlueprintPure, Category = "Interaction|Input")
+	EInteractionInputDevice GetCurrentInputDevice() const { return CurrentDevice; }
+
+	UFUNCTION(BlueprintPure, Category = "Interaction|Input")
+	bool IsUsingGamepad() const { return CurrentDevice == EInteractionInputDevice::IID_Gamepad; }
+
+	/** Switch device (called by the input processor; broadcasts on change only) */
+	void SetCurrentInputDevice(EInteractionInputDevice NewDevice);
+
+	/** Fires when the player switches device */
+	FOnInteractionInputDeviceChanged OnInputDeviceChanged;
+
+	// ═══════════════════════════════════════════════
+	// KEY BINDINGS
+	// ═══════════════════════════════════════════════
+
+	/**
+	 * Key bound to an action for the current device
+	 * Falls back to the other device's key (wrong device is better than nothing)
+	 * @return EKeys::Invalid if the action has no mapping
+	 */
+	UFUNCTION(BlueprintPure, Category = "Interaction|Input")
+	FKey GetKeyForAction(const UInputAction* InputAction) const;
+
+	/** Drop the cached table (rebuilt on next lookup) and notify listeners */
+	UFUNCTION(BlueprintCallable, Category = "Interaction|Input")
+	void InvalidateKeyBindings();
+
+	/** Fires after mappings change; re-query GetKeyForAction */
+	FOnInteractionKeyBindingsChanged OnKeyBindingsChanged;
+
+	/** Analog deflection that counts as gamepad use */
+	UPROPERTY(BlueprintReadWrite, Category = "Interaction|Input", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float GamepadAnalogThreshold = 0.25f;
+
+private:
+	struct FActionKeys
+	{
+		FKey KeyboardKey;
+		FKey GamepadKey;
+	};
+
+	/** Query Enhanced Input for one action (first key per device wins) */
+	FActionKeys ResolveActionKeys(const UInputAction* InputAction) const;
+
+	UFUNCTION()
+	void HandleControlMappingsRebuilt();
+
+	EInteractionInputDevice CurrentDevice = EInteractionInputDevice::IID_KeyboardMouse;
+
+	/** Action -> first keyboard and gamepad key (filled on lookup) */
+	mutable TMap<TObjectKey<UInputAction>, FActionKeys> ActionKeys;
+
+	UPROPERTY()
+	TObjectPtr<UEnhancedInputLocalPlayerSubsystem> EnhancedInput;
+
+	TSharedPtr<FInteractionInputProcessor> InputProcessor;
+};
@@ -11,10 +11,14 @@ class UTextBlock;
 class UOverlay;
 class UMaterialInstanceDynamic;
 class UInputAction;
-class UEnhancedInputLocalPlayerSubsystem;
+class UInteractionInputSubsystem;
+enum class EInteractionInputDevice : uint8;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogInteractableWidget, Log, All);
 
+/** Pulls the current hold/mash progress [0-1] (sampled only while the widget ticks, i.e. is visible) */
+DECLARE_DELEGATE_RetVal(float, FInteractionProgressSampler);
+
 /**
  * EInteractionWidgetState - Widget display states
  */
@@ -187,6 +191,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Interaction")
 	void SetProgress(float Progress);
 
+	/**
+	 * Pull progress instead of having it pushed every frame
+	 * Sampled in NativeTick while Holding/Mashing; unbound on any other state
+	 */
+	void SetProgressSampler(FInteractionProgressSampler InSampler) { ProgressSampler = MoveTemp(InSampler); }
+
 	/**
 	 * Get current progress value
 	 */
@@ -201,6 +211,7 @@ public:
 
 	/**
 	 * Force refresh input mode (keyboard vs gamepad)
+	 * Normally driven by UInteractionInputSubsystem's change events
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Interaction")
 	void RefreshInputMode();
@@ -247,6 +258,10 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Interaction|State")
 	FKey CurrentInputKey;
 
+	/** Action CurrentInputKey was resolved from (null when set by key) - re-resolved on binding/device change */
+	UPROPERTY(BlueprintReadOnly, Category = "Interaction|State")
+	TObjectPtr<UInputAction> CurrentInputAction;
+
 	// ═══════════════════════════════════════════════
 	// INTERNAL
 	// ═══════════════════════════════════════════════
@@ -264,9 +279,18 @@ protected:
 	/** Cached last progress to avoid redundant updates */
 	float LastSetProgress = -1.0f;
 
+	/** Progress source while Holding/Mashing (see SetProgressSampler) */
+	FInteractionProgressSampler ProgressSampler;
+
 	/** Cached last input mode to detect changes */
 	bool bLastInputModeGamepad = false;
 
+	/** Source of device/binding change events (bound in NativeConstruct) */
+	TWeakObjectPtr<UInteractionInputSubsystem> InputSubsystem;
+
+	FDelegateHandle InputDeviceChangedHandle;
+	FDelegateHandle KeyBindingsChangedHandle;
+
 	// ═══════════════════════════════════════════════
 	// INTERNAL METHODS
 	// ═══════════════════════════════════════════════
@@ -283,14 +307,20 @@ protected:
 	/** Get current fill color based on state */
 	FLinearColor GetCurrentFillColor() const;
 
-	/** Detect current input mode */
+	/** Current input mode as published by UInteractionInputSubsystem */
 	bool DetectGamepadMode() const;
 
+	/** Device switched - swap border material and icon */
+	void HandleInputDeviceChanged(EInteractionInputDevice NewDevice);
+
+	/** Mappings changed - re-resolve CurrentInputAction's key */
+	void HandleKeyBindingsChanged();
+
 	/** Handle state-specific tick logic */
 	void TickState(float DeltaTime);
 
 	/**
-	 * Get the bound key for an InputAction from Enhanced Input system
+	 * Get the bound key for an InputAction (cached table in UInteractionInputSubsystem)
 	 * Automatically gets keyboard or gamepad key based on current input mode
 	 * @param InputAction - The Enhanced Input Action to query
 	 * @return The currently bound FKey, or EKeys::Invalid if not found
@@ -298,8 +328,8 @@ protected:
 	FKey GetBoundKeyForInputAction(UInputAction* InputAction) const;
 
 	/**
-	 * Get Enhanced Input Subsystem
+	 * Get the owning (or first) local player's interaction input subsystem
 	 * Helper to reduce code duplication
 	 */
-	UEnhancedInputLocalPlayerSubsystem* GetEnhancedInputSubsystem() const;
+	UInteractionInputSubsystem* GetInteractionInputSubsystem() const;
 };
\ No newline at end of file
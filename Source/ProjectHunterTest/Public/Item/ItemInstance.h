@@ -12,6 +12,7 @@ class UAbilitySystemComponent;
 class UStaticMesh;
 class USkeletalMesh;
 class UMaterialInstance;
+class UConsumableCooldownManager;
 
 /**
  * Runtime Item Instance 
@@ -96,13 +97,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, SaveGame, Category = "Item|Consumable")
 	int32 RemainingUses = 1;
 
-	/** Cooldown remaining in seconds */
-	UPROPERTY(BlueprintReadWrite, Category = "Item|Consumable")
-	float CooldownRemaining = 0.0f;
-
-	/** Last use timestamp (for cooldown tracking) */
+	/**
+	 * Last use world time (cooldowns themselves live on UConsumableCooldownManager)
+	 * Only read as a per-item fallback when no cooldown manager can be found.
+	 */
 	UPROPERTY(BlueprintReadWrite, SaveGame, Category = "Item|Consumable")
-	float LastUseTime = 0.0f;
+	double LastUseTime = 0.0;
 
 	// ═══════════════════════════════════════════════
 	// DURABILITY (Equipment)
@@ -332,18 +332,37 @@ public:
 
 	/**
 	 * Check if consumable can be used
+	 * Cooldown is checked against the actor that owns this item (see CanUseConsumableForUser)
 	 * @return True if can be used (not on cooldown, has uses remaining, etc.)
 	 */
 	UFUNCTION(BlueprintPure, Category = "Item|Consumable")
 	bool CanUseConsumable() const;
 
 	/**
-	 * Get cooldown progress (0.0 to 1.0)
+	 * Check if consumable can be used by a specific actor
+	 * @param User - Actor using the item (cooldown is checked on its UConsumableCooldownManager).
+	 *               If null or without a manager, the owning actor's manager is used, then this
+	 *               item's own LastUseTime - the cooldown is never skipped.
+	 * @return True if can be used (not on cooldown, has uses remaining, etc.)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Item|Consumable")
+	bool CanUseConsumableForUser(const AActor* User) const;
+
+	/**
+	 * Get cooldown progress (0.0 to 1.0) for the actor that owns this item
 	 * @return 1.0 if ready, 0.0 if just used
 	 */
 	UFUNCTION(BlueprintPure, Category = "Item|Consumable")
 	float GetCooldownProgress() const;
 
+	/**
+	 * Get cooldown progress (0.0 to 1.0) for a specific actor
+	 * @param User - Actor owning the cooldown (same fallbacks as CanUseConsumableForUser)
+	 * @return 1.0 if ready, 0.0 if just used
+	 */
+	UFUNCTION(BlueprintPure, Category = "Item|Consumable")
+	float GetCooldownProgressForUser(const AActor* User) const;
+
 	// ═══════════════════════════════════════════════
 	// SETTERS (For Loot System Integration)
 	// ═══════════════════════════════════════════════
@@ -578,6 +597,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Item|Serialization")
 	void PostLoadInitialize();
 
+	/**
+	 * Compact versioned binary save/load (see FItemCompactSerializer)
+	 * Writes only roll inputs + quantized affix values, rebuilds the rest from templates.
+	 * For many items use FItemCompactSerializer::SerializeItems (shared name tables).
+	 * @return False on version mismatch or missing templates
+	 */
+	bool SerializeCompact(FArchive& Ar);
+
 private:
 	/** Generate rare/legendary name for high-grade items */
 	FText GenerateRareName() const;
@@ -585,6 +612,9 @@ private:
 	/** Apply consumable effects to target */
 	bool ApplyConsumableEffects(AActor* Target);
 
-	/** Update cooldown timer */
-	void UpdateCooldown(float DeltaTime);
+	/** User's cooldown manager, else the owning actor's (null if neither has one) */
+	const UConsumableCooldownManager* FindCooldownManager(const AActor* User) const;
+
+	/** Per-item fallback cooldown progress from LastUseTime (no manager available) */
+	float GetLocalCooldownProgress() const;
 };
\ No newline at end of file
@@ -364,6 +364,10 @@ struct FConsumableData
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Consumable")
 	float Cooldown = 0.0f;
 
+	/** Items sharing a group share one cooldown (None = per base item) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Consumable")
+	FName CooldownGroup = NAME_None;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Consumable")
 	TArray<TSubclassOf<UGameplayEffect>> EffectsToApply;
 
@@ -625,6 +629,10 @@ struct FPHItemStats
 	UPROPERTY(SaveGame, BlueprintReadOnly, Category = "Stats")
 	bool bAffixesGenerated = false;
 
+	/** Base row the implicit/unique affixes were copied from (lets NetSerialize send them by position) */
+	UPROPERTY()
+	FDataTableRowHandle SourceBaseItem;
+
 	FPHItemStats() = default;
 
 	/** Get total count of all stats (zero allocation) */
@@ -739,6 +747,21 @@ struct FPHItemStats
 		Crafted.Empty();
 		bAffixesGenerated = false;
 	}
+
+	/**
+	 * Compact net serialization (template name + quantized value per affix)
+	 * See FItemCompactSerializer
+	 */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FPHItemStats> : public TStructOpsTypeTraitsBase2<FPHItemStats>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
 };
 
 // ═══════════════════════════════════════════════════════════════════════
@@ -0,0 +1,225 @@
+// Item/Serialization/ItemCompactSerializer.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Item/Library/ItemStructs.h"
+#include "Item/Library/AffixEnums.h"
+
+// Forward declarations
+class UItemInstance;
+class UDataTable;
+class UPackageMap;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogItemSerialization, Log, All);
+
+/**
+ * Compact item format versions
+ * Add new entries ABOVE VersionPlusOne, never reorder
+ */
+enum class EItemCompactVersion : uint8
+{
+	Initial = 1,
+	PackedItemLevel = 2,        // ItemLevel written packed instead of clamped to a byte
+
+	VersionPlusOne,
+	Latest = VersionPlusOne - 1
+};
+
+/**
+ * Where an affix's static data (name, range, attribute, display) comes from
+ * Stored in the low bits of the per-affix flags byte
+ */
+enum class EAffixTemplateSource : uint8
+{
+	Raw         = 0,    // No template found - full struct written
+	BaseList    = 1,    // FItemBase::ImplicitMods / UniqueAffixes (by position)
+	PrefixTable = 2,    // DT_Prefixes row (by AttributeName)
+	SuffixTable = 3     // DT_Suffixes row (by AttributeName)
+};
+
+/**
+ * Item Compact Serializer
+ *
+ * SINGLE RESPONSIBILITY: Versioned binary encoding of item instances
+ *
+ * Writes only what cannot be rebuilt from static data:
+ * - Base item (index into a per-blob name table)
+ * - Seed, level, rarity, quantity, uses
+ * - Durability (quantized, relative to the base item's max)
+ * - Per affix: template index, quantized rolled value, flags
+ *
+ * Everything else (FText names, ranges, attributes, display format)
+ * is copied back from the template on load (delta-from-template).
+ * Display names are regenerated lazily by UItemInstance::GetDisplayName().
+ *
+ * NOT persisted: LastUseTime is a world-time stamp and means nothing once that world
+ * is gone, so it is reset on load (live cooldowns belong to UConsumableCooldownManager).
+ *
+ * BLOB LAYOUT (SerializeItems):
+ *   Magic | Version | BaseTables[] | BaseRows[] | AffixTemplates[] | ItemCount | Items...
+ * Template tables are stored by name, so reordering DataTable rows
+ * never invalidates saved data.
+ */
+struct PROJECTHUNTERTEST_API FItemCompactSerializer
+{
+public:
+	FItemCompactSerializer();
+
+	/**
+	 * Shared instance for net serialization (template lookups are cached)
+	 * Templates are cached by row name and resolved per use, so DataTable reloads
+	 * and PIE restarts never leave it pointing at freed rows. Game thread only.
+	 */
+	static FItemCompactSerializer& Get();
+
+	// ═══════════════════════════════════════════════
+	// BLOB API (Stash / Inventory / Snapshots)
+	// ═══════════════════════════════════════════════
+
+	/**
+	 * Serialize an array of items with a shared header
+	 * @param Ar - Archive (saving or loading)
+	 * @param Items - Items to write, or output array when loading
+	 * @param Outer - Outer for created items when loading (transient package if null)
+	 * @param OutWrittenIndices - Saving only: indices into Items that were written (rejected items are skipped)
+	 * @return False if the blob is corrupt or from a newer version (loading needs an archive with a known size)
+	 */
+	bool SerializeItems(FArchive& Ar, TArray<UItemInstance*>& Items, UObject* Outer = nullptr, TArray<int32>* OutWrittenIndices = nullptr);
+
+	/**
+	 * Convenience wrappers for memory blobs
+	 */
+	bool SaveItemsToBytes(const TArray<UItemInstance*>& Items, TArray<uint8>& OutBytes);
+	bool LoadItemsFromBytes(const TArray<uint8>& Bytes, TArray<UItemInstance*>& OutItems, UObject* Outer = nullptr);
+
+	/**
+	 * Streaming read of a SerializeItems blob (time-sliced loading)
+	 * BeginReadItems reads the header, then ReadNextItem once per item.
+	 * The serializer and archive must outlive the whole read.
+	 */
+	bool BeginReadItems(FArchive& Ar, int32& OutItemCount);
+	UItemInstance* ReadNextItem(FArchive& Ar, UObject* Outer = nullptr);
+	void EndReadItems();
+
+	/**
+	 * Serialize one self-describing item (version header + handle by path)
+	 * Larger per item than SerializeItems - use for single transfers only.
+	 */
+	bool SerializeStandalone(FArchive& Ar, UItemInstance* Item);
+
+	// ═══════════════════════════════════════════════
+	// PER-ITEM API (Used by blob + net paths)
+	// ═══════════════════════════════════════════════
+
+	/**
+	 * Serialize a single item's payload (no header)
+	 * Base rows and affix templates go through this serializer's name tables.
+	 */
+	bool SerializeItemPayload(FArchive& Ar, UItemInstance* Item);
+
+	/**
+	 * Serialize item stats
+	 * @param Base - Base item (needed for implicit/unique templates, may be null)
+	 * @param Map - Package map when net serializing (names sent via SerializeName)
+	 */
+	bool SerializeStats(FArchive& Ar, FPHItemStats& Stats, const FItemBase* Base, UPackageMap* Map = nullptr);
+
+	// ═══════════════════════════════════════════════
+	// QUANTIZATION HELPERS
+	// ═══════════════════════════════════════════════
+
+	static uint16 QuantizeUnit(float Alpha)
+	{
+		return static_cast<uint16>(FMath::RoundToInt(FMath::Clamp(Alpha, 0.0f, 1.0f) * 65535.0f));
+	}
+
+	static float DequantizeUnit(uint16 Quantized)
+	{
+		return static_cast<float>(Quantized) / 65535.0f;
+	}
+
+private:
+	// ═══════════════════════════════════════════════
+	// INTERNAL
+	// ═══════════════════════════════════════════════
+
+	bool SerializeAffixList(
+		FArchive& Ar,
+		TArray<FPHAttributeData>& Affixes,
+		const TArray<FPHAttributeData>* BaseList,
+		UPackageMap* Map);
+
+	bool SerializeAffix(
+		FArchive& Ar,
+		FPHAttributeData& Affix,
+		const TArray<FPHAttributeData>* BaseList,
+		int32 Position,
+		UPackageMap* Map);
+
+	/** Find static template for a rolled affix (write side) */
+	const FPHAttributeData* ResolveTemplate(
+		const FPHAttributeData& Affix,
+		const TArray<FPHAttributeData>* BaseList,
+		int32 Position,
+		EAffixTemplateSource& OutSource) const;
+
+	/** Serialize a template key (blob: index into name table, net: FName) */
+	void SerializeTemplateName(FArchive& Ar, EAffixTemplateSource Source, FName& Name, UPackageMap* Map);
+
+	/** AttributeName -> row lookup for prefix/suffix tables (row resolved on every call) */
+	const FPHAttributeData* FindTableTemplate(EAffixTemplateSource Source, FName AttributeName) const;
+
+	struct FTemplateTableCache;
+
+	/** (Re)build one table's AttributeName -> RowName lookup */
+	void BuildTemplateCache(EAffixTemplateSource Source, FTemplateTableCache& Cache) const;
+
+	int32 GetOrAddBaseRow(const FDataTableRowHandle& Handle);
+	int32 GetOrAddAffixTemplate(EAffixTemplateSource Source, FName AttributeName);
+
+	void ResetTables();
+
+	// ═══════════════════════════════════════════════
+	// NAME TABLES (per blob)
+	// ═══════════════════════════════════════════════
+
+	struct FBaseRowEntry
+	{
+		int32 TableIndex = INDEX_NONE;
+		FName RowName;
+	};
+
+	struct FAffixTemplateEntry
+	{
+		EAffixTemplateSource Source = EAffixTemplateSource::Raw;
+		FName AttributeName;
+	};
+
+	TArray<UDataTable*> BaseTables;
+	TArray<FBaseRowEntry> BaseRows;
+	TArray<FAffixTemplateEntry> AffixTemplates;
+
+	TMap<TPair<UDataTable*, FName>, int32> BaseRowLookup;
+	TMap<TPair<uint8, FName>, int32> AffixTemplateLookup;
+
+	// ═══════════════════════════════════════════════
+	// CACHED TEMPLATE TABLES
+	// ═══════════════════════════════════════════════
+
+	/** Row names only - row memory is owned by the table and moves on reload */
+	struct FTemplateTableCache
+	{
+		TWeakObjectPtr<UDataTable> Table;
+		TMap<FName, FName> RowByAttribute;
+		bool bBuilt = false;
+	};
+
+	mutable FTemplateTableCache PrefixTemplates;
+	mutable FTemplateTableCache SuffixTemplates;
+
+	/** True inside SerializeItems (template keys are name table indices) */
+	bool bUseNameTables = false;
+
+	/** Version of the blob currently being read/written */
+	EItemCompactVersion ArchiveVersion = EItemCompactVersion::Latest;
+};
@@ -0,0 +1,217 @@
+// Tower/Actors/GroundItemNetCell.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Engine/DataTable.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "Item/Library/ItemEnums.h"
+#include "GroundItemNetCell.generated.h"
+
+// Forward declarations
+class AGroundItemNetCell;
+class UStaticMesh;
+struct FGroundItemNetArray;
+
+/**
+ * One replicated ground item (visual and label data only - no affixes)
+ *
+ * NetSerialize writes ~11 bytes:
+ * - ItemID, BaseIndex, Quantity (packed ints)
+ * - Rarity (1 byte)
+ * - Location: X/Y as cm offset from the cell corner (2 bytes each), Z packed
+ * - Yaw (1 byte)
+ */
+USTRUCT()
+struct PROJECTHUNTERTEST_API FGroundItemNetEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	/** Server ground item ID (same ID on every machine) */
+	UPROPERTY()
+	int32 ItemID = INDEX_NONE;
+
+	/** Index into the owning cell's BasePalette */
+	UPROPERTY()
+	uint16 BaseIndex = 0;
+
+	UPROPERTY()
+	EItemRarity Rarity = EItemRarity::IR_None;
+
+	/** Stack count (clients have no UItemInstance to read it from) */
+	UPROPERTY()
+	int32 Quantity = 1;
+
+	/** cm from the cell's min corner */
+	UPROPERTY()
+	uint16 OffsetX = 0;
+
+	UPROPERTY()
+	uint16 OffsetY = 0;
+
+	/** World Z in cm */
+	UPROPERTY()
+	int32 Z = 0;
+
+	/** Yaw in 256 steps */
+	UPROPERTY()
+	uint8 Yaw = 0;
+
+	void SetLocation(const FIntPoint& Cell, const FVector& Location);
+	FVector GetLocation(const FIntPoint& Cell) const;
+
+	void SetRotation(const FRotator& Rotation);
+	FRotator GetRotation() const;
+
+	// FFastArraySerializer callbacks (client)
+	void PreReplicatedRemove(const FGroundItemNetArray& InArraySerializer);
+	void PostReplicatedAdd(const FGroundItemNetArray& InArraySerializer);
+	void PostReplicatedChange(const FGroundItemNetArray& InArraySerializer);
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FGroundItemNetEntry> : public TStructOpsTypeTraitsBase2<FGroundItemNetEntry>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+/**
+ * Delta-replicated entry list for one cell
+ */
+USTRUCT()
+struct PROJECTHUNTERTEST_API FGroundItemNetArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FGroundItemNetEntry> Items;
+
+	/** Not replicated - set by the owning cell */
+	AGroundItemNetCell* Owner = nullptr;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FGroundItemNetEntry, FGroundItemNetArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FGroundItemNetArray> : public TStructOpsTypeTraitsBase2<FGroundItemNetArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true
+	};
+};
+
+/**
+ * AGroundItemNetCell - Replicates the ground items of one spatial cell
+ *
+ * SINGLE RESPONSIBILITY: Carry ground item visuals to clients near this cell
+ *
+ * SERVER: Spawned/filled by FGroundItemReplicator, destroyed when empty
+ * CLIENT: Feeds UGroundItemSubsystem, which builds local ISM instances
+ *
+ * OPTIMIZATION: Relevancy is per cell (IsNetRelevantFor), so each
+ * connection only opens channels for cells around its view target.
+ * Leaving the area closes the channel and the client drops those items.
+ */
+UCLASS(NotBlueprintable, NotPlaceable)
+class PROJECTHUNTERTEST_API AGroundItemNetCell : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AGroundItemNetCell();
+
+	/** Cell edge length (cm) - must stay below 65535 for the offset encoding */
+	static constexpr float CellSize = 2000.0f;
+
+	static FIntPoint GetCellCoord(const FVector& Location);
+
+	// ═══════════════════════════════════════════════
+	// ACTOR OVERRIDES
+	// ═══════════════════════════════════════════════
+
+	virtual void PostInitProperties() override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// ═══════════════════════════════════════════════
+	// SERVER API
+	// ═══════════════════════════════════════════════
+
+	/** Must be called before FinishSpawning */
+	void InitializeCell(const FIntPoint& InCell);
+
+	void AddEntry(int32 ItemID, const FDataTableRowHandle& BaseItemHandle, EItemRarity Rarity, int32 Quantity, const FVector& Location, const FRotator& Rotation);
+
+	/** @return False if the ID is not in this cell */
+	bool RemoveEntry(int32 ItemID);
+
+	/** Location must stay inside this cell */
+	bool UpdateEntryLocation(int32 ItemID, const FVector& Location);
+
+	/** @return False if the ID is not in this cell */
+	bool UpdateEntryQuantity(int32 ItemID, int32 Quantity);
+
+	const FGroundItemNetEntry* FindEntry(int32 ItemID) const;
+
+	const FDataTableRowHandle* GetBaseItemHandle(uint16 BaseIndex) const;
+
+	int32 GetNumEntries() const { return Entries.Items.Num(); }
+
+	FIntPoint GetCell() const { return Cell; }
+
+	int32 GetRelevantCellRadius() const { return RelevantCellRadius; }
+
+	// ═══════════════════════════════════════════════
+	// CLIENT API (called by FGroundItemNetEntry)
+	// ═══════════════════════════════════════════════
+
+	void ClientApplyEntry(const FGroundItemNetEntry& Entry);
+	void ClientRemoveEntry(const FGroundItemNetEntry& Entry);
+
+protected:
+	/** Viewers within this many cells (Chebyshev) receive this cell */
+	UPROPERTY(EditDefaultsOnly, Category = "Replication")
+	int32 RelevantCellRadius = 2;
+
+	UPROPERTY(Replicated)
+	FIntPoint Cell = FIntPoint::ZeroValue;
+
+	/** Base items used by this cell (append-only, declared before Entries so it arrives first) */
+	UPROPERTY(ReplicatedUsing = OnRep_BasePalette)
+	TArray<FDataTableRowHandle> BasePalette;
+
+	UPROPERTY(Replicated)
+	FGroundItemNetArray Entries;
+
+	UFUNCTION()
+	void OnRep_BasePalette();
+
+	UPROPERTY()
+	USceneComponent* RootSceneComponent;
+
+private:
+	uint16 GetOrAddBaseIndex(const FDataTableRowHandle& BaseItemHandle);
+
+	/** Client: palette index -> ground mesh */
+	UStaticMesh* ResolveMesh(uint16 BaseIndex);
+
+	/** Server: ItemID -> index in Entries.Items */
+	TMap<int32, int32> EntryIndexByID;
+
+	/** Client: resolved meshes, aligned with BasePalette */
+	UPROPERTY()
+	TArray<UStaticMesh*> ResolvedMeshes;
+
+	/** Client: an entry arrived before its palette row */
+	bool bHasUnresolvedEntries = false;
+};
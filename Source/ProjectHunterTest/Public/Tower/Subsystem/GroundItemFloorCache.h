@@ -0,0 +1,62 @@
+// Tower/Subsystem/GroundItemFloorCache.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "GroundItemFloorCache.generated.h"
+
+/**
+ * UGroundItemFloorCache - Ground item snapshots that outlive the world
+ *
+ * SINGLE RESPONSIBILITY: Hold per-floor ground item blobs between floor visits
+ *
+ * UGroundItemSubsystem stores its floor here on teardown and takes it back
+ * (time-sliced rebuild) when the same floor begins play again.
+ *
+ * Floors are keyed by SetNextFloorKey (set by whatever loads the floor, before
+ * the world begins play). Without one the map name is used, so every floor built
+ * on the same map shares one slot.
+ */
+UCLASS()
+class PROJECTHUNTERTEST_API UGroundItemFloorCache : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Replaces any previous snapshot for this floor */
+	void StoreFloor(FName FloorID, TArray<uint8>&& Bytes);
+
+	/**
+	 * Move a floor's snapshot out of the cache
+	 * @return False if nothing is stored for FloorID
+	 */
+	bool TakeFloor(FName FloorID, TArray<uint8>& OutBytes);
+
+	UFUNCTION(BlueprintPure, Category = "Ground Items|Floors")
+	bool HasFloor(FName FloorID) const { return Floors.Contains(FloorID); }
+
+	/** Drop a floor's items for good (e.g. floor reset) */
+	UFUNCTION(BlueprintCallable, Category = "Ground Items|Floors")
+	void ForgetFloor(FName FloorID);
+
+	UFUNCTION(BlueprintCallable, Category = "Ground Items|Floors")
+	void ForgetAllFloors();
+
+	/** Total snapshot bytes held */
+	int64 GetTotalBytes() const;
+
+	/**
+	 * Floor the next world to begin play belongs to (sticky until changed)
+	 * None = key floors by map name
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Ground Items|Floors")
+	void SetNextFloorKey(FName FloorKey) { NextFloorKey = FloorKey; }
+
+	UFUNCTION(BlueprintPure, Category = "Ground Items|Floors")
+	FName GetNextFloorKey() const { return NextFloorKey; }
+
+private:
+	FName NextFloorKey;
+
+	TMap<FName, TArray<uint8>> Floors;
+};
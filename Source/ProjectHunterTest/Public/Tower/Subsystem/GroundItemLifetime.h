@@ -0,0 +1,137 @@
+// Tower/Subsystem/GroundItemLifetime.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Item/Library/ItemEnums.h"
+#include "GroundItemLifetime.generated.h"
+
+/**
+ * Why ground items left the world without being picked up
+ */
+UENUM(BlueprintType)
+enum class EGroundItemDespawnReason : uint8
+{
+	GIDR_Expired    UMETA(DisplayName = "Expired (Lifetime)"),
+	GIDR_Evicted    UMETA(DisplayName = "Evicted (Cap)")
+};
+
+/**
+ * Ground item lifetime + cap configuration
+ */
+USTRUCT(BlueprintType)
+struct PROJECTHUNTERTEST_API FGroundItemLifetimeSettings
+{
+	GENERATED_BODY()
+
+	/** Seconds on the ground per rarity (missing or <= 0 = never expires) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lifetime")
+	TMap<EItemRarity, float> LifetimeByRarity;
+
+	/**
+	 * Hard cap on ground item count (0 = unlimited)
+	 * Off by default - eviction is a safety net for runaway floors, set it per game mode
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lifetime|Cap")
+	int32 MaxGroundItems = 0;
+
+	/** Hard cap on estimated ground item memory in MB (0 = unlimited, off by default) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lifetime|Cap")
+	float MaxGroundItemMemoryMB = 0.0f;
+
+	/** When a cap is hit, evict down to this fraction of it (avoids evicting every frame) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lifetime|Cap", meta = (ClampMin = "0.5", ClampMax = "1.0"))
+	float EvictionTargetFraction = 0.95f;
+
+	FGroundItemLifetimeSettings()
+	{
+		// Commons clear quickly, named and above stay until picked up
+		LifetimeByRarity.Add(EItemRarity::IR_None, 120.0f);
+		LifetimeByRarity.Add(EItemRarity::IR_GradeF, 120.0f);
+		LifetimeByRarity.Add(EItemRarity::IR_GradeE, 180.0f);
+		LifetimeByRarity.Add(EItemRarity::IR_GradeD, 300.0f);
+		LifetimeByRarity.Add(EItemRarity::IR_GradeC, 600.0f);
+	}
+
+	float GetLifetime(EItemRarity Rarity) const
+	{
+		const float* Found = LifetimeByRarity.Find(Rarity);
+		return Found ? *Found : 0.0f;
+	}
+
+	/**
+	 * Eviction tier (lower goes first)
+	 * None / Unknown / Corrupted sit below Grade F - they come after SS in the enum
+	 */
+	static int32 GetEvictionRank(EItemRarity Rarity)
+	{
+		switch (Rarity)
+		{
+			case EItemRarity::IR_GradeF:  return 1;
+			case EItemRarity::IR_GradeE:  return 2;
+			case EItemRarity::IR_GradeD:  return 3;
+			case EItemRarity::IR_GradeC:  return 4;
+			case EItemRarity::IR_GradeB:  return 5;
+			case EItemRarity::IR_GradeA:  return 6;
+			case EItemRarity::IR_GradeS:  return 7;
+			case EItemRarity::IR_GradeSS: return 8;
+			default:                      return 0;
+		}
+	}
+};
+
+/**
+ * FGroundItemTimingWheel - Hashed timing wheel for ground item expiry
+ *
+ * SINGLE RESPONSIBILITY: Tell the subsystem which IDs expire this tick
+ *
+ * - Fixed ring of slots, one slot per Resolution seconds
+ * - Entries further out than one lap carry a lap counter
+ * - Advance only visits slots the clock passed, so per-frame cost
+ *   depends on what expires now, not on how many items exist
+ * - Picked-up items are not removed from the wheel; each entry carries
+ *   the item's storage generation, and callers drop entries whose ID is
+ *   gone or now belongs to a newer item (snapshot restores reuse IDs)
+ */
+struct PROJECTHUNTERTEST_API FGroundItemTimingWheel
+{
+public:
+	static constexpr int32 NumSlots = 256;
+	static constexpr float Resolution = 1.0f;
+
+	/** Entry that came due */
+	struct FExpired
+	{
+		int32 ItemID;
+		uint32 Generation;
+	};
+
+	/** Schedule ItemID (at this storage generation) to expire Lifetime seconds after CurrentTime */
+	void Schedule(int32 ItemID, uint32 Generation, float CurrentTime, float Lifetime);
+
+	/**
+	 * Advance the clock to CurrentTime
+	 * @param OutExpired - Entries that came due (may include removed or reused IDs)
+	 */
+	void Advance(float CurrentTime, TArray<FExpired>& OutExpired);
+
+	void Reset();
+
+	int32 GetNumScheduled() const { return NumScheduled; }
+
+private:
+	struct FEntry
+	{
+		int32 ItemID;
+		uint32 Generation;
+		int32 LapsRemaining;
+	};
+
+	int64 TimeToTick(float Time) const { return FMath::FloorToInt64(Time / Resolution); }
+
+	TArray<FEntry> Slots[NumSlots];
+
+	/** Last tick that was processed (-1 = not started) */
+	int64 CurrentTick = -1;
+
+	int32 NumScheduled = 0;
+};
@@ -0,0 +1,60 @@
+// Tower/Subsystem/GroundItemReplicator.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+class UWorld;
+class UItemInstance;
+class AGroundItemNetCell;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogGroundItemReplication, Log, All);
+
+/**
+ * FGroundItemReplicator - Server side of ground item replication
+ *
+ * SINGLE RESPONSIBILITY: Mirror server ground items into per-cell net actors
+ *
+ * - One AGroundItemNetCell per occupied cell (spawned on first item, destroyed when empty)
+ * - Driven by UGroundItemSubsystem on add / remove / move
+ * - Inactive in standalone and on clients (no actors, no cost)
+ */
+struct PROJECTHUNTERTEST_API FGroundItemReplicator
+{
+public:
+	FGroundItemReplicator();
+
+	void Initialize(UWorld* World);
+
+	/** True on dedicated / listen servers */
+	bool IsActive() const;
+
+	// ═══════════════════════════════════════════════
+	// MIRRORING
+	// ═══════════════════════════════════════════════
+
+	void AddItem(int32 ItemID, const UItemInstance* Item, const FVector& Location, const FRotator& Rotation);
+
+	void RemoveItem(int32 ItemID, const FVector& Location);
+
+	void MoveItem(int32 ItemID, const FVector& OldLocation, const FVector& NewLocation);
+
+	/** Push label data (stack count) after the item changed in place */
+	void RefreshItem(int32 ItemID, const UItemInstance* Item, const FVector& Location);
+
+	/** Destroy every cell actor */
+	void Reset();
+
+	int32 GetNumCells() const { return Cells.Num(); }
+
+private:
+	AGroundItemNetCell* FindCell(const FIntPoint& CellCoord) const;
+	AGroundItemNetCell* FindOrSpawnCell(const FIntPoint& CellCoord);
+
+	/** Destroy the cell if it holds nothing */
+	void ReleaseIfEmpty(AGroundItemNetCell* Cell);
+
+	UWorld* WorldContext;
+
+	TMap<FIntPoint, TWeakObjectPtr<AGroundItemNetCell>> Cells;
+};
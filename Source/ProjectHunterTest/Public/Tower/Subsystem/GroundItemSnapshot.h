@@ -0,0 +1,76 @@
+// Tower/Subsystem/GroundItemSnapshot.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Item/Serialization/ItemCompactSerializer.h"
+#include "Serialization/MemoryReader.h"
+
+// Forward declarations
+class UItemInstance;
+
+/**
+ * Where one ground item sat when the snapshot was taken
+ */
+struct FGroundItemSnapshotRecord
+{
+	int32 ItemID = INDEX_NONE;
+	FVector Location = FVector::ZeroVector;
+	float Yaw = 0.0f;
+
+	/** Seconds the item had been on the ground (lifetimes resume, not restart) */
+	float Age = 0.0f;
+};
+
+/**
+ * FGroundItemSnapshot - Compact per-floor ground item blob
+ *
+ * SINGLE RESPONSIBILITY: Encode/decode ground items for floor transitions
+ *
+ * BLOB LAYOUT:
+ *   Magic | Version | Count | Records (ID, location, yaw, age) | Item blob (FItemCompactSerializer)
+ *
+ * Records are decoded up front (cheap); items are read one at a time so
+ * the subsystem can rebuild a floor over several frames.
+ */
+struct PROJECTHUNTERTEST_API FGroundItemSnapshot
+{
+public:
+	/** Records and Items must be index-aligned */
+	static bool Write(const TArray<FGroundItemSnapshotRecord>& Records, const TArray<UItemInstance*>& Items, TArray<uint8>& OutBytes);
+
+	// ═══════════════════════════════════════════════
+	// STREAMING READ
+	// ═══════════════════════════════════════════════
+
+	/**
+	 * Take ownership of a blob and decode its records + item header
+	 * @return False if the blob is corrupt or from a newer version
+	 */
+	bool Open(TArray<uint8>&& InBytes);
+
+	/**
+	 * Read items until the budget runs out (always reads at least one)
+	 * @param OutItems / OutRecords - Appended, index-aligned
+	 * @return Items read this call (0 once done or on error)
+	 */
+	int32 ReadItems(double BudgetSeconds, TArray<UItemInstance*>& OutItems, TArray<FGroundItemSnapshotRecord>& OutRecords, UObject* Outer = nullptr);
+
+	bool IsDone() const { return bFailed || NextIndex >= Records.Num(); }
+
+	int32 GetNumItems() const { return Records.Num(); }
+
+	int32 GetNumRead() const { return NextIndex; }
+
+	int32 GetMaxItemID() const { return MaxItemID; }
+
+private:
+	TArray<uint8> Bytes;
+	TUniquePtr<FMemoryReader> Reader;
+	FItemCompactSerializer Serializer;
+
+	TArray<FGroundItemSnapshotRecord> Records;
+
+	int32 NextIndex = 0;
+	int32 MaxItemID = INDEX_NONE;
+	bool bFailed = false;
+};
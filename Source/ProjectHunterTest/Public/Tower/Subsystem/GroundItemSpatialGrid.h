@@ -0,0 +1,139 @@
+// Tower/Subsystem/GroundItemSpatialGrid.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * FGroundItemSpatialGrid - Uniform spatial hash for ground item queries
+ *
+ * SINGLE RESPONSIBILITY: Answer "what is near this point" without full scans
+ *
+ * - 2D (XY) cells keyed by FIntPoint, only occupied cells are stored
+ * - Each cell packs IDs + locations contiguously (distance tests stay in-cell)
+ * - Maintained incrementally by UGroundItemSubsystem (add / remove / move)
+ * - Nearest search walks rings of cells outward and stops early
+ *
+ * Z is ignored for bucketing (floors are flat-ish) but used in distance tests.
+ */
+struct PROJECTHUNTERTEST_API FGroundItemSpatialGrid
+{
+public:
+	/** One nearest-item request inside a batch */
+	struct FNearestQuery
+	{
+		FVector Location = FVector::ZeroVector;
+		float MaxDistance = 0.0f;
+
+		/** Output */
+		int32 ResultID = INDEX_NONE;
+		float ResultDistSq = 0.0f;
+	};
+
+	/** Default cell edge length (cm) - roughly 2x the default interaction distance */
+	static constexpr float DefaultCellSize = 500.0f;
+
+	explicit FGroundItemSpatialGrid(float InCellSize = DefaultCellSize);
+
+	// ═══════════════════════════════════════════════
+	// MAINTENANCE
+	// ═══════════════════════════════════════════════
+
+	void Add(int32 ItemID, const FVector& Location);
+
+	/** @return False if the item was not found in the cell for OldLocation */
+	bool Remove(int32 ItemID, const FVector& Location);
+
+	/** Move an item (only touches cells if the cell changed) */
+	void Move(int32 ItemID, const FVector& OldLocation, const FVector& NewLocation);
+
+	void Reset();
+
+	// ═══════════════════════════════════════════════
+	// QUERIES
+	// ═══════════════════════════════════════════════
+
+	/**
+	 * Find nearest item within MaxDistance
+	 * @return Item ID, or INDEX_NONE if nothing in range
+	 */
+	int32 FindNearest(const FVector& Location, float MaxDistance, float* OutDistSq = nullptr) const;
+
+	/**
+	 * Answer many nearest queries in one pass
+	 * Each occupied cell is scanned once no matter how many queries overlap it,
+	 * so cost is (items in touched cells + query/cell pairs), not items x queries.
+	 */
+	void FindNearestBatch(TArrayView<FNearestQuery> Queries) const;
+
+	/**
+	 * Visit every item within Radius (cells outside the radius AABB are never touched)
+	 * @param Visitor - void(int32 ItemID, const FVector& Location)
+	 */
+	template<typename FuncType>
+	void ForEachInRadius(const FVector& Location, float Radius, FuncType&& Visitor) const
+	{
+		const float RadiusSq = Radius * Radius;
+		const FIntPoint MinCell = GetCellCoord(Location - FVector(Radius, Radius, 0.0f));
+		const FIntPoint MaxCell = GetCellCoord(Location + FVector(Radius, Radius, 0.0f));
+
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+			{
+				const FCell* Cell = Cells.Find(FIntPoint(X, Y));
+				if (!Cell)
+				{
+					continue;
+				}
+
+				for (int32 i = 0; i < Cell->ItemIDs.Num(); ++i)
+				{
+					if (FVector::DistSquared(Location, Cell->Locations[i]) <= RadiusSq)
+					{
+						Visitor(Cell->ItemIDs[i], Cell->Locations[i]);
+					}
+				}
+			}
+		}
+	}
+
+	// ═══════════════════════════════════════════════
+	// ACCESSORS
+	// ═══════════════════════════════════════════════
+
+	FIntPoint GetCellCoord(const FVector& Location) const
+	{
+		return FIntPoint(
+			FMath::FloorToInt(Location.X * InvCellSize),
+			FMath::FloorToInt(Location.Y * InvCellSize));
+	}
+
+	float GetCellSize() const { return CellSize; }
+	int32 GetNumOccupiedCells() const { return Cells.Num(); }
+
+	/** Heap bytes held by the cell map and per-cell arrays */
+	SIZE_T GetAllocatedSize() const;
+
+	/** Number of items in a cell (0 if empty) */
+	int32 GetCellItemCount(const FIntPoint& CellCoord) const
+	{
+		const FCell* Cell = Cells.Find(CellCoord);
+		return Cell ? Cell->ItemIDs.Num() : 0;
+	}
+
+private:
+	/** Parallel arrays - IDs and locations stay packed per cell */
+	struct FCell
+	{
+		TArray<int32> ItemIDs;
+		TArray<FVector> Locations;
+	};
+
+	/** Scan one cell, updating best candidate */
+	void ScanCell(const FIntPoint& CellCoord, const FVector& Location, float& InOutBestDistSq, int32& InOutBestID) const;
+
+	TMap<FIntPoint, FCell> Cells;
+
+	float CellSize;
+	float InvCellSize;
+};
@@ -0,0 +1,144 @@
+// Tower/Subsystem/GroundItemStorage.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Item/Library/ItemEnums.h"
+#include "GroundItemStorage.generated.h"
+
+// Forward declarations
+class UItemInstance;
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+
+/**
+ * Struct to track ISM instance data
+ */
+USTRUCT()
+struct FGroundItemISMData
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	UInstancedStaticMeshComponent* ISMComponent = nullptr;
+
+	int32 InstanceIndex = INDEX_NONE;
+
+	UPROPERTY()
+	UStaticMesh* Mesh = nullptr;
+
+	FGroundItemISMData() = default;
+
+	FGroundItemISMData(UInstancedStaticMeshComponent* InISM, int32 InIndex, UStaticMesh* InMesh)
+		: ISMComponent(InISM)
+		, InstanceIndex(InIndex)
+		, Mesh(InMesh)
+	{}
+
+	bool IsValid() const { return ISMComponent != nullptr && InstanceIndex != INDEX_NONE; }
+};
+
+/**
+ * FGroundItemStorage - Sparse-set, structure-of-arrays ground item store
+ *
+ * SINGLE RESPONSIBILITY: Own per-item ground data in packed arrays
+ *
+ * DENSE (index-aligned, always packed, swap-remove):
+ * - IDs, Generations, Locations, Rotations, Items, ISMSlots, SpawnTimes, Rarities, EvictionValues, MemoryEstimates
+ *
+ * SPARSE (ID -> dense index):
+ * - Paged so IDs can grow forever without a giant table
+ * - Pages are released once every ID in them is gone
+ *
+ * Scans (debug draw, despawn sweeps, snapshots) stream the dense arrays;
+ * lookups by ID are one page index + one array read, no hashing.
+ */
+USTRUCT()
+struct PROJECTHUNTERTEST_API FGroundItemStorage
+{
+	GENERATED_BODY()
+
+public:
+	// ═══════════════════════════════════════════════
+	// MUTATION
+	// ═══════════════════════════════════════════════
+
+	/**
+	 * Add an item under a new ID
+	 * @return Dense index of the new entry
+	 */
+	int32 Add(int32 ItemID, UItemInstance* Item, const FVector& Location, const FRotator& Rotation, const FGroundItemISMData& ISMSlot, float SpawnTime);
+
+	/**
+	 * Remove by ID (last dense entry is swapped into the hole)
+	 * @return False if the ID is not stored
+	 */
+	bool Remove(int32 ItemID);
+
+	void Reset();
+
+	// ═══════════════════════════════════════════════
+	// LOOKUP
+	// ═══════════════════════════════════════════════
+
+	/** @return Dense index, or INDEX_NONE */
+	int32 FindIndex(int32 ItemID) const;
+
+	bool Contains(int32 ItemID) const { return FindIndex(ItemID) != INDEX_NONE; }
+
+	int32 Num() const { return IDs.Num(); }
+
+	/** Heap bytes held by the dense arrays and sparse pages */
+	SIZE_T GetAllocatedSize() const;
+
+	// ═══════════════════════════════════════════════
+	// DENSE ARRAYS (index-aligned, read freely - mutate only through the API above)
+	// ═══════════════════════════════════════════════
+
+	TArray<int32> IDs;
+
+	/** Unique per Add, so anything keyed on an ID can tell a reused ID from the original */
+	TArray<uint32> Generations;
+
+	TArray<FVector> Locations;
+
+	/** Placement rotation (kept here so snapshots never read ISM transforms during teardown) */
+	TArray<FRotator> Rotations;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UItemInstance>> Items;
+
+	UPROPERTY()
+	TArray<FGroundItemISMData> ISMSlots;
+
+	/** World time the item hit the ground */
+	TArray<float> SpawnTimes;
+
+	/** Item rarity (kept here so replicated items without a UItemInstance still have it) */
+	TArray<EItemRarity> Rarities;
+
+	/** Item value at drop time (lowest evicted first when over cap) */
+	TArray<int32> EvictionValues;
+
+	/** Estimated bytes held by this item while on the ground */
+	TArray<int32> MemoryEstimates;
+
+private:
+	// ═══════════════════════════════════════════════
+	// SPARSE INDEX
+	// ═══════════════════════════════════════════════
+
+	static constexpr int32 PageShift = 12;
+	static constexpr int32 PageSize = 1 << PageShift;
+	static constexpr int32 PageMask = PageSize - 1;
+
+	void SetSparse(int32 ItemID, int32 DenseIndex);
+
+	/** Empty page = not allocated */
+	TArray<TArray<int32>> SparsePages;
+
+	/** Live IDs per page (page freed at zero) */
+	TArray<int32> PageLiveCounts;
+
+	/** Never reset, so generations stay unique across Reset() */
+	uint32 NextGeneration = 0;
+};
@@ -3,6 +3,12 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "Tower/Subsystem/GroundItemSpatialGrid.h"
+#include "Tower/Subsystem/GroundItemStorage.h"
+#include "Tower/Subsystem/GroundItemLifetime.h"
+#include "Tower/Subsystem/GroundItemReplicator.h"
+#include "Tower/Subsystem/GroundItemSnapshot.h"
+#include "Tower/Actors/GroundItemNetCell.h"
 #include "GroundItemSubsystem.generated.h"
 
 // Forward declarations
@@ -10,34 +16,89 @@ class UItemInstance;
 class AISMContainerActor;
 class UInstancedStaticMeshComponent;
 class UStaticMesh;
+struct FItemBase;
 
 /**
- * Struct to track ISM instance data
+ * Radius query result - ID and item together (no reverse lookup needed)
+ */
+USTRUCT(BlueprintType)
+struct FGroundItemEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 ItemID = INDEX_NONE;
+
+	UPROPERTY(BlueprintReadOnly)
+	UItemInstance* Item = nullptr;
+
+	FGroundItemEntry() = default;
+
+	FGroundItemEntry(int32 InItemID, UItemInstance* InItem)
+		: ItemID(InItemID)
+		, Item(InItem)
+	{}
+};
+
+/**
+ * ISM partition key - one component per (cell, mesh)
  */
 USTRUCT()
-struct FGroundItemISMData
+struct FGroundItemISMKey
 {
 	GENERATED_BODY()
 
 	UPROPERTY()
-	UInstancedStaticMeshComponent* ISMComponent = nullptr;
-
-	int32 InstanceIndex = INDEX_NONE;
+	FIntPoint Cell = FIntPoint::ZeroValue;
 
 	UPROPERTY()
 	UStaticMesh* Mesh = nullptr;
 
-	FGroundItemISMData() = default;
+	FGroundItemISMKey() = default;
 
-	FGroundItemISMData(UInstancedStaticMeshComponent* InISM, int32 InIndex, UStaticMesh* InMesh)
-		: ISMComponent(InISM)
-		, InstanceIndex(InIndex)
+	FGroundItemISMKey(const FIntPoint& InCell, UStaticMesh* InMesh)
+		: Cell(InCell)
 		, Mesh(InMesh)
 	{}
 
-	bool IsValid() const { return ISMComponent != nullptr && InstanceIndex != INDEX_NONE; }
+	bool operator==(const FGroundItemISMKey& Other) const
+	{
+		return Cell == Other.Cell && Mesh == Other.Mesh;
+	}
+
+	friend uint32 GetTypeHash(const FGroundItemISMKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.Cell), GetTypeHash(Key.Mesh));
+	}
 };
 
+/**
+ * Pile representative for a collapsed cluster of distant items
+ */
+USTRUCT(BlueprintType)
+struct FGroundItemPile
+{
+	GENERATED_BODY()
+
+	/** Centroid of the clustered items */
+	UPROPERTY(BlueprintReadOnly)
+	FVector Location = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 Count = 0;
+
+	UPROPERTY(BlueprintReadOnly)
+	EItemRarity HighestRarity = EItemRarity::IR_None;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnGroundItemsDespawned, const TArray<UItemInstance*>&, Items, EGroundItemDespawnReason, Reason);
+
+/** Native only - fires for every add, including replicated client items */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnGroundItemAdded, int32 /*ItemID*/, const FVector& /*Location*/);
+
+/** Native only - fires for every removal (pickup, expiry, eviction, replication, prediction) */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnGroundItemRemoved, int32 /*ItemID*/, const FVector& /*Location*/);
+
 /**
  * UGroundItemSubsystem - Manages items on the ground using ISM
  * 
@@ -46,10 +107,44 @@ struct FGroundItemISMData
  * FIXES APPLIED:
  * - Thread safety for removal operations
  * - Batch removal support
- * - Proper ISM index reindexing
+ * - O(1) ISM removal (swap-remove + per-ISM reverse index)
+ *
+ * OPTIMIZATION: Proximity queries go through a spatial hash grid
+ * (only cells overlapping the query are touched, never a full scan)
+ *
+ * OPTIMIZATION: Per-item data lives in a sparse-set SoA store
+ * (one sparse lookup per ID, scans stream packed arrays)
+ *
+ * OPTIMIZATION: Nearest-item queries from all interactors are batched
+ * (answered together once per ProximityBatchInterval)
+ *
+ * OPTIMIZATION: ISM instance creation is deferred to Tick
+ * (one AddInstances call per ISM per frame, however many items dropped)
+ *
+ * OPTIMIZATION: ISMs are partitioned per (cell, mesh)
+ * (cell-sized bounds cull per component, adds/removes touch small buffers,
+ * empty partitions are released)
+ *
+ * OPTIMIZATION: Pile LOD - crowded partitions beyond PileCollapseDistance are
+ * hidden and drawn as one pile instance per grid cell (items stay queryable)
+ *
+ * LIFETIME: Items expire per rarity via a timing wheel, and count/memory
+ * caps evict lowest-value items first (both through batch removal)
+ *
+ * FLOORS: On teardown the floor's items are snapshotted into UGroundItemFloorCache;
+ * when the floor begins play again they are rebuilt a few ms per frame. The floor
+ * key is latched at begin play from UGroundItemFloorCache::SetNextFloorKey (map name
+ * if unset - floors sharing a map then share a slot); EnterFloor switches floors
+ * without a world change.
+ *
+ * NETWORKING: The server mirrors items into per-cell AGroundItemNetCell actors
+ * (FGroundItemReplicator); clients rebuild ISMs from what they receive.
+ * Replicated items have no UItemInstance on clients (GetItemByID returns null;
+ * GetItemDisplayInfo reads the replicated base row instead), and clients must
+ * not call AddItemToGround in networked games (IDs are the server's).
  */
 UCLASS()
-class PROJECTHUNTERTEST_API UGroundItemSubsystem : public UWorldSubsystem
+class PROJECTHUNTERTEST_API UGroundItemSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
@@ -61,19 +156,40 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 	virtual bool ShouldCreateSubsystem(UObject* Outer) const override { return true; }
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UGroundItemSubsystem, STATGROUP_Tickables); }
 
 	// ═══════════════════════════════════════════════
 	// PRIMARY API
 	// ═══════════════════════════════════════════════
 
+	/**
+	 * Add an item to the ground
+	 * Item is queryable immediately; its mesh instance appears on the next flush (same frame)
+	 * @return Ground item ID, or -1 on failure
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Ground Items")
 	int32 AddItemToGround(UItemInstance* Item, FVector Location, FRotator Rotation = FRotator::ZeroRotator);
 
+	/**
+	 * Add many items at once (loot explosions)
+	 * @param Locations - One per item
+	 * @return Ground item IDs aligned with Items (-1 for items that failed)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Ground Items")
+	TArray<int32> AddItemsToGround(const TArray<UItemInstance*>& Items, const TArray<FVector>& Locations);
+
+	/** Create ISM instances for all queued adds (normally done once per frame by Tick) */
+	void FlushPendingInstances();
+
 	UFUNCTION(BlueprintCallable, Category = "Ground Items")
 	UItemInstance* RemoveItemFromGround(int32 ItemID);
 
 	/**
 	 * Remove multiple items efficiently (FIX: batch removal)
+	 * One RemoveInstances call per ISM, no per-item reindexing
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Ground Items")
 	TArray<UItemInstance*> RemoveMultipleItemsFromGround(const TArray<int32>& ItemIDs);
@@ -85,6 +201,18 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Ground Items")
 	UItemInstance* GetItemByID(int32 ItemID) const;
 
+	/**
+	 * Name and stack count for labels - from the UItemInstance on the server,
+	 * from the replicated base row and count on clients
+	 * @return False if the item is unknown
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Ground Items")
+	bool GetItemDisplayInfo(int32 ItemID, FText& OutName, int32& OutQuantity) const;
+
+	/** Server: re-publish an item changed in place (e.g. stack count) to clients */
+	UFUNCTION(BlueprintCallable, Category = "Ground Items")
+	void NotifyItemChanged(int32 ItemID);
+
 	UFUNCTION(BlueprintCallable, Category = "Ground Items")
 	UItemInstance* GetNearestItem(FVector Location, float MaxDistance, int32& OutItemID);
 
@@ -94,6 +222,14 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Ground Items")
 	TArray<UItemInstance*> GetItemInstancesInRadius(FVector Location, float Radius);
 
+	/**
+	 * Get (ID, item) pairs in radius in one pass
+	 * Prefer this over GetItemInstancesInRadius + GetInstanceID
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Ground Items")
+	int32 GetItemEntriesInRadius(FVector Location, float Radius, TArray<FGroundItemEntry>& OutEntries);
+
+	/** O(1) via reverse item -> ID map */
 	UFUNCTION(BlueprintPure, Category = "Ground Items")
 	int32 GetInstanceID(UItemInstance* Item) const;
 
@@ -103,14 +239,221 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Ground Items")
 	void ClearAllItems();
 
+	// ═══════════════════════════════════════════════
+	// BATCHED PROXIMITY QUERIES
+	// ═══════════════════════════════════════════════
+
+	/**
+	 * Register a persistent nearest-item query (one per interactor)
+	 * @return Handle for Update/Get/Unregister
+	 */
+	int32 RegisterProximityQuery();
+
+	void UnregisterProximityQuery(int32 QueryHandle);
+
+	/** Set where the query looks from (used by the next batch) */
+	void UpdateProximityQuery(int32 QueryHandle, const FVector& Location, float MaxDistance);
+
+	/**
+	 * Latest batched result
+	 * @return Item ID, or INDEX_NONE if nothing in range (or item already removed)
+	 */
+	int32 GetProximityResult(int32 QueryHandle) const;
+
+	/** Answer all registered queries now (normally done by Tick) */
+	void ProcessProximityQueries();
+
+	/** Seconds between batched proximity passes (match interaction CheckFrequency) */
+	float ProximityBatchInterval = 0.1f;
+
+	// ═══════════════════════════════════════════════
+	// LIFETIME & CAPS
+	// ═══════════════════════════════════════════════
+
+	/** Per-rarity lifetimes and hard caps (lifetime applies to items dropped after the change) */
+	UPROPERTY(BlueprintReadWrite, Category = "Ground Items|Lifetime")
+	FGroundItemLifetimeSettings LifetimeSettings;
+
+	/**
+	 * Called with items removed by expiry or eviction
+	 * Items are no longer referenced by the subsystem - recycle or let GC take them
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Ground Items|Lifetime")
+	FOnGroundItemsDespawned OnGroundItemsDespawned;
+
+	/** Item placed on the ground (server drop, snapshot restore or replicated arrival) */
+	FOnGroundItemAdded OnGroundItemAdded;
+
+	/** Item taken off the ground (not fired by ClearAllItems) */
+	FOnGroundItemRemoved OnGroundItemRemoved;
+
+	/** Estimated memory held by ground items (bytes) */
+	int64 GetEstimatedMemoryBytes() const { return TotalMemoryEstimate; }
+
+	// ═══════════════════════════════════════════════
+	// REPLICATION (CLIENT)
+	// ═══════════════════════════════════════════════
+
+	/**
+	 * Add or update a server item received through a net cell
+	 * Idempotent - an item moving between cells may arrive before it leaves the old one
+	 */
+	void ApplyReplicatedItem(AGroundItemNetCell* Cell, const FGroundItemNetEntry& Entry, UStaticMesh* Mesh);
+
+	/** Remove items a net cell no longer holds (skips items another cell has since claimed) */
+	void RemoveReplicatedItems(AGroundItemNetCell* Cell, const TArray<int32>& ItemIDs);
+
+	/**
+	 * Client-predicted pickup: take items off the ground before the server answers
+	 * They are removed locally but remembered, so RestorePredictedItems can put them back
+	 * @return IDs actually hidden (unknown or already hidden IDs are skipped)
+	 */
+	TArray<int32> HidePredictedItems(const TArray<int32>& ItemIDs);
+
+	/** Server confirmed the pickup - forget the hidden items */
+	void ConfirmPredictedItems(const TArray<int32>& ItemIDs);
+
+	/** Server refused the pickup - put hidden items back (skips any the server removed meanwhile) */
+	void RestorePredictedItems(const TArray<int32>& ItemIDs);
+
+	bool IsItemPredictedRemoved(int32 ItemID) const { return PredictedRemovals.Contains(ItemID); }
+
+	/**
+	 * Name, stack count and rarity of an item hidden by HidePredictedItems, for pending
+	 * placeholders in the inventory (it is off the ground, so GetItemDisplayInfo no longer knows it)
+	 * @return False if the item is not pending or its base row cannot be resolved
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Ground Items")
+	bool GetPredictedItemDisplayInfo(int32 ItemID, FText& OutName, int32& OutQuantity, EItemRarity& OutRarity) const;
+
+	/** Hidden items with no answer after this long are put back (lost ack, pawn gone) */
+	UPROPERTY(BlueprintReadWrite, Category = "Ground Items|Replication", meta = (ClampMin = "0.1"))
+	float PredictedRemovalTimeout = 5.0f;
+
+	// ═══════════════════════════════════════════════
+	// RENDERING
+	// ═══════════════════════════════════════════════
+
+	/** ISM partition edge length (cm) - change only while the ground is empty */
+	UPROPERTY(BlueprintReadWrite, Category = "Ground Items|Rendering")
+	float ISMCellSize = 4000.0f;
+
+	/**
+	 * Use HISM for new partitions (cluster culling + LOD for dense cells)
+	 * Every add/remove rebuilds the partition's cluster tree - leave off for high-churn floors
+	 */
+	UPROPERTY(BlueprintReadWrite, Category = "Ground Items|Rendering")
+	bool bUseHierarchicalISM = false;
+
+	/** Default instance cull distance (cm, 0 = never culled) */
+	UPROPERTY(BlueprintReadWrite, Category = "Ground Items|Rendering")
+	float ISMCullDistance = 8000.0f;
+
+	/**
+	 * Override cull distance for the partition cell containing Location
+	 * @param CullDistance - cm, 0 = never culled, < 0 = back to ISMCullDistance
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Ground Items|Rendering")
+	void SetCellCullDistance(FVector Location, float CullDistance);
+
+	FIntPoint GetISMCell(const FVector& Location) const;
+
+	int32 GetNumISMComponents() const { return CellISMs.Num(); }
+
+	// ═══════════════════════════════════════════════
+	// PILE LOD
+	// ═══════════════════════════════════════════════
+
+	/** Mesh for pile representatives (null = pile LOD off) */
+	UPROPERTY(BlueprintReadWrite, Category = "Ground Items|Pile LOD")
+	UStaticMesh* PileMesh = nullptr;
+
+	/** Partitions further than this from every local viewer collapse into piles (cm) */
+	UPROPERTY(BlueprintReadWrite, Category = "Ground Items|Pile LOD")
+	float PileCollapseDistance = 6000.0f;
+
+	/** Collapsed partitions expand again at PileCollapseDistance - this (no flicker at the edge) */
+	UPROPERTY(BlueprintReadWrite, Category = "Ground Items|Pile LOD")
+	float PileHysteresis = 500.0f;
+
+	/** Partitions with fewer items are always drawn individually */
+	UPROPERTY(BlueprintReadWrite, Category = "Ground Items|Pile LOD")
+	int32 PileMinItems = 8;
+
+	/** Seconds between LOD evaluations */
+	UPROPERTY(BlueprintReadWrite, Category = "Ground Items|Pile LOD")
+	float PileUpdateInterval = 0.25f;
+
+	/** Current pile representatives (labels should show these instead of collapsed items) */
+	const TArray<FGroundItemPile>& GetPiles() const { return Piles; }
+
+	/** True if the item at this location is currently drawn as part of a pile */
+	UFUNCTION(BlueprintPure, Category = "Ground Items|Pile LOD")
+	bool IsLocationCollapsed(FVector Location) const { return CollapsedCells.Contains(GetISMCell(Location)); }
+
+	/** Re-evaluate pile LOD now (normally done by Tick) */
+	void UpdatePileLOD();
+
+	// ═══════════════════════════════════════════════
+	// FLOOR SNAPSHOTS
+	// ═══════════════════════════════════════════════
+
+	/** Snapshot on teardown and restore on begin play (server / standalone only) */
+	UPROPERTY(BlueprintReadWrite, Category = "Ground Items|Floors")
+	bool bPersistFloorItems = true;
+
+	/** Game-thread time spent rebuilding a snapshot per frame (ms) */
+	UPROPERTY(BlueprintReadWrite, Category = "Ground Items|Floors")
+	float RestoreBudgetMs = 2.0f;
+
+	/**
+	 * Write every ground item (ID, location, yaw, age + compact item payload)
+	 * @return False if there was nothing to write or serialization failed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Ground Items|Floors")
+	bool SaveSnapshot(TArray<uint8>& OutBytes);
+
+	/**
+	 * Start rebuilding items from a snapshot (spread over frames by RestoreBudgetMs)
+	 * Items keep their saved IDs unless already taken.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Ground Items|Floors")
+	bool RestoreSnapshot(const TArray<uint8>& Bytes);
+
+	UFUNCTION(BlueprintPure, Category = "Ground Items|Floors")
+	bool IsRestoringSnapshot() const { return ActiveRestore.IsValid(); }
+
+	/** Finish any in-progress restore this frame */
+	void FinishRestoreNow();
+
+	/** Key this world's items are snapshotted under (latched at begin play) */
+	UFUNCTION(BlueprintPure, Category = "Ground Items|Floors")
+	FName GetFloorKey() const { return ActiveFloorKey; }
+
+	/**
+	 * Switch floors inside the same world (e.g. floors streamed on one map):
+	 * snapshot and clear the current floor, then restore FloorKey's items if cached
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Ground Items|Floors")
+	void EnterFloor(FName FloorKey);
+
 	// ═══════════════════════════════════════════════
 	// ACCESSORS
 	// ═══════════════════════════════════════════════
 
 	UFUNCTION(BlueprintPure, Category = "Ground Items")
-	int32 GetTotalItemCount() const { return GroundItems.Num(); }
+	int32 GetTotalItemCount() const { return Storage.Num(); }
 
-	const TMap<int32, FVector>& GetInstanceLocations() const { return InstanceLocations; }
+	/** @return Item location, or nullptr if the ID is not on the ground */
+	const FVector* GetItemLocation(int32 ItemID) const;
+
+	/** Packed per-item arrays (read only) */
+	const FGroundItemStorage& GetStorage() const { return Storage; }
+
+	const FGroundItemSpatialGrid& GetSpatialGrid() const { return SpatialGrid; }
+
+	/** Actor owning every ground item ISM (ignore it to trace past items) */
+	AISMContainerActor* GetISMContainer() const { return ISMContainerActor; }
 
 #if WITH_EDITOR
 	UFUNCTION(BlueprintCallable, Category = "Ground Items|Debug")
@@ -123,8 +466,38 @@ protected:
 	// ═══════════════════════════════════════════════
 
 	void EnsureISMContainerExists();
-	UInstancedStaticMeshComponent* GetOrCreateISMComponent(UStaticMesh* Mesh);
-	void ReindexAfterRemoval(UInstancedStaticMeshComponent* ISMComponent, int32 RemovedIndex);
+
+	/** Partition component for this mesh at this location */
+	UInstancedStaticMeshComponent* GetOrCreateISMComponent(UStaticMesh* Mesh, const FVector& Location);
+
+	void ApplyCullDistance(UInstancedStaticMeshComponent* ISM, const FIntPoint& Cell) const;
+
+	/** Destroy partitions that are still empty (after the flush, so queued adds keep theirs) */
+	void ReleaseEmptyISMs();
+
+	/** Rebuild pile instances for the collapsed partitions */
+	void RebuildPiles();
+
+	/** Expand everything and drop pile instances */
+	void ResetPileLOD();
+
+	/** Every local player's view location (split-screen has several; none on dedicated servers) */
+	void GetViewerLocations(TArray<FVector, TInlineAllocator<4>>& OutLocations) const;
+
+	/** Hide a partition inside a pile - also drops its collision so hidden items stop blocking traces */
+	static void SetPartitionCollapsed(UInstancedStaticMeshComponent* ISM, bool bCollapsed);
+
+	/**
+	 * Remove one ISM instance and patch the single item that was swapped into its slot
+	 * @return False if the index is out of range
+	 */
+	bool RemoveISMInstance(UInstancedStaticMeshComponent* ISM, int32 InstanceIndex);
+
+	/**
+	 * Remove many instances from one ISM in a single RemoveInstances call
+	 * @param InstanceIndices - Sorted descending, no duplicates
+	 */
+	void RemoveISMInstances(UInstancedStaticMeshComponent* ISM, const TArray<int32>& InstanceIndices);
 
 private:
 	// ═══════════════════════════════════════════════
@@ -133,6 +506,40 @@ private:
 
 	UItemInstance* RemoveItemFromGroundInternal(int32 ItemID);
 
+	/**
+	 * Validate + store + queue ISM instance (no logging on success)
+	 * @param ForcedItemID - Use this ID if free (snapshot restore)
+	 * @param InitialAge - Seconds already spent on the ground (lifetime resumes)
+	 */
+	int32 AddItemToGroundInternal(UItemInstance* Item, const FVector& Location, const FRotator& Rotation,
+		int32 ForcedItemID = INDEX_NONE, float InitialAge = 0.0f);
+
+	/** Rebuild the next slice of ActiveRestore */
+	void ProcessSnapshotRestore(double BudgetSeconds);
+
+	/** Teardown: store this floor in UGroundItemFloorCache */
+	void StoreFloorSnapshot();
+
+	/** @return True if the item was still waiting for its ISM instance (and is no longer queued) */
+	bool CancelPendingInstance(int32 ItemID);
+
+	/** Remove expired items (timing wheel) */
+	void ProcessLifetimes();
+
+	/** Client: put back predicted removals the server never answered */
+	void ExpirePredictedRemovals();
+
+	/** Evict lowest-value items until under count/memory caps */
+	void EnforceCaps();
+
+	/** Batch-remove and broadcast OnGroundItemsDespawned */
+	TArray<UItemInstance*> DespawnItems(const TArray<int32>& ItemIDs, EGroundItemDespawnReason Reason);
+
+	static int32 EstimateItemMemory(const UItemInstance* Item);
+
+	/** Drop an item's bookkeeping (storage + grid) - ISM instance must already be gone */
+	UItemInstance* RemoveItemRecord(int32 ItemID);
+
 	// ═══════════════════════════════════════════════
 	// DATA
 	// ═══════════════════════════════════════════════
@@ -140,20 +547,132 @@ private:
 	UPROPERTY()
 	AISMContainerActor* ISMContainerActor;
 
+	/** Per-item data (IDs, locations, items, ISM slots, spawn times) */
 	UPROPERTY()
-	TMap<int32, UItemInstance*> GroundItems;
+	FGroundItemStorage Storage;
 
+	/** Reverse of Storage (item -> ground ID) */
 	UPROPERTY()
-	TMap<int32, FVector> InstanceLocations;
+	TMap<UItemInstance*, int32> ItemToID;
 
+	/** ISM partitions */
 	UPROPERTY()
-	TMap<int32, FGroundItemISMData> ItemISMData;
+	TMap<FGroundItemISMKey, UInstancedStaticMeshComponent*> CellISMs;
 
-	UPROPERTY()
-	TMap<UStaticMesh*, UInstancedStaticMeshComponent*> MeshToISM;
+	/** Reverse of CellISMs */
+	TMap<UInstancedStaticMeshComponent*, FGroundItemISMKey> ISMKeys;
+
+	/** Partitions that emptied since the last release pass */
+	TSet<UInstancedStaticMeshComponent*> EmptyISMCandidates;
+
+	/** Per-cell cull distance overrides */
+	TMap<FIntPoint, float> CellCullDistances;
+
+	/**
+	 * Reverse index per ISM: instance index -> item ID
+	 * ISMs use swap-remove, so a removal only ever moves the last instance
+	 */
+	TMap<UInstancedStaticMeshComponent*, TArray<int32>> ISMInstanceItemIDs;
+
+	/** Spatial index over Storage locations (kept in sync on add/remove/move) */
+	FGroundItemSpatialGrid SpatialGrid;
+
+	/** Server: mirrors Storage into replicated net cells */
+	FGroundItemReplicator Replicator;
+
+	/** Client: the net cell that currently owns a replicated item, and its last entry */
+	struct FReplicatedItem
+	{
+		TWeakObjectPtr<AGroundItemNetCell> Cell;
+		FGroundItemNetEntry Entry;
+	};
+
+	TMap<int32, FReplicatedItem> ReplicatedItems;
+
+	/** Base row of a replicated item, from the owning cell's palette */
+	static const FItemBase* GetReplicatedBaseRow(const FReplicatedItem& Replicated);
+
+	/** Client: enough of a predicted-away item to re-apply it if the server refuses */
+	struct FPredictedRemoval
+	{
+		FReplicatedItem Source;
+		TWeakObjectPtr<UStaticMesh> Mesh;
+
+		/** World time the item was hidden */
+		double HiddenTime = 0.0;
+	};
+
+	/** Client: items hidden by HidePredictedItems, awaiting the server's answer */
+	TMap<int32, FPredictedRemoval> PredictedRemovals;
 
 	int32 NextItemID = 0;
 
+	// ═══════════════════════════════════════════════
+	// DEFERRED ISM INSERTION
+	// ═══════════════════════════════════════════════
+
+	/**
+	 * Items waiting for their ISM instance (transform is read from Storage at flush)
+	 * A set so cancelling one (batch removal, moves) is O(1)
+	 */
+	TSet<int32> PendingInstances;
+
+	/** Floor cache key for the items currently in this world */
+	FName ActiveFloorKey;
+
+	// ═══════════════════════════════════════════════
+	// LIFETIME STATE
+	// ═══════════════════════════════════════════════
+
+	FGroundItemTimingWheel LifetimeWheel;
+
+	int64 TotalMemoryEstimate = 0;
+
+	/** Set on add, cleared once caps have been checked */
+	bool bCapCheckPending = false;
+
+	TArray<FGroundItemTimingWheel::FExpired> ExpiredScratch;
+
+	// ═══════════════════════════════════════════════
+	// PROXIMITY QUERY REGISTRY
+	// ═══════════════════════════════════════════════
+
+	struct FProximityQuerySlot
+	{
+		FVector Location = FVector::ZeroVector;
+		float MaxDistance = 0.0f;
+		int32 ResultID = INDEX_NONE;
+		bool bHasLocation = false;
+	};
+
+	TSparseArray<FProximityQuerySlot> ProximityQueries;
+
+	/** Scratch buffer reused every batch */
+	TArray<FGroundItemSpatialGrid::FNearestQuery> ProximityScratch;
+	TArray<int32> ProximityScratchHandles;
+
+	float TimeSinceProximityBatch = 0.0f;
+
+	// ═══════════════════════════════════════════════
+	// PILE LOD STATE
+	// ═══════════════════════════════════════════════
+
+	/** Collapsed partition cell -> item count when its piles were built */
+	TMap<FIntPoint, int32> CollapsedCells;
+
+	TArray<FGroundItemPile> Piles;
+
+	UPROPERTY()
+	UInstancedStaticMeshComponent* PileISM = nullptr;
+
+	float TimeSincePileUpdate = 0.0f;
+
+	// ═══════════════════════════════════════════════
+	// SNAPSHOT RESTORE STATE
+	// ═══════════════════════════════════════════════
+
+	TUniquePtr<FGroundItemSnapshot> ActiveRestore;
+
 	// ═══════════════════════════════════════════════
 	// THREAD SAFETY (FIX)
 	// ═══════════════════════════════════════════════